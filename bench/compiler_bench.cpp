@@ -0,0 +1,189 @@
+#include <fcntl.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "backend.h"
+#include "driver.h"
+#include "inliner.h"
+#include "ir.h"
+#include "output_buffer.h"
+#include "parser_driver.h"
+#include "semantic_visitor.h"
+#include "source_file.h"
+
+namespace {
+
+const char* const kWorkloads[] = {
+    "arith_loop",   "recursion",     "array_sweep",
+    "deep_nesting", "fire_headless", "many_functions",
+};
+
+// Phases timed separately, in pipeline order.
+enum Phase { kParse, kSemantic, kOptimize, kExecute, kPhaseCount };
+
+const char* const kPhaseNames[kPhaseCount] = {
+    "parse", "semantic", "optimize", "execute",
+};
+
+using Clock = std::chrono::steady_clock;
+
+int64_t Nanoseconds(Clock::duration duration) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(duration)
+        .count();
+}
+
+struct Result {
+    std::string name;
+    int exit_code = 0;
+    // Samples of each phase, one per run.
+    std::vector<int64_t> samples[kPhaseCount];
+};
+
+struct Options {
+    Backend backend = Backend::TreeWalker;
+    int inline_budget = Inliner::kDefaultBudget;
+    size_t jobs = 1;
+    // Every run starts rand() from seed, so randomized workloads do the
+    // same work.
+    uint64_t seed = 1;
+};
+
+// Compiles and runs the source once, adding a sample per phase. Program
+// output goes to out, so printing is measured but not shown.
+void RunOnce(std::string_view source, const Options& options,
+             OutputBuffer& out, Result* result) {
+    auto start = Clock::now();
+    auto lap = [&start](std::vector<int64_t>* samples) {
+        auto now = Clock::now();
+        samples->push_back(Nanoseconds(now - start));
+        start = now;
+    };
+
+    EzAquarii::ParserDriver parser_driver;
+    parser_driver.switchInputBuffer(source);
+    if (parser_driver.parse()) throw std::runtime_error("parse error");
+    IR ir;
+    ir.SetAST(parser_driver.GetAST());
+    lap(&result->samples[kParse]);
+
+    SemanticVisitor semantic_visitor(&ir, options.jobs);
+    ir.GetAST()->accept(&semantic_visitor);
+    lap(&result->samples[kSemantic]);
+
+    Driver::Optimize(&ir, options.inline_budget);
+    lap(&result->samples[kOptimize]);
+
+    result->exit_code =
+        Execute(options.backend, ir, out, nullptr, options.seed);
+    out.Flush();
+    lap(&result->samples[kExecute]);
+}
+
+void PrintPhase(std::ostream& os, std::vector<int64_t> samples) {
+    std::sort(samples.begin(), samples.end());
+    int64_t total = 0;
+    for (auto sample : samples) total += sample;
+    os << "{\"min_ns\": " << samples.front()
+       << ", \"median_ns\": " << samples[samples.size() / 2]
+       << ", \"mean_ns\": " << total / static_cast<int64_t>(samples.size())
+       << ", \"max_ns\": " << samples.back() << "}";
+}
+
+void PrintJson(std::ostream& os, std::string_view backend, int repeat,
+               const std::vector<Result>& results) {
+    os << "{\n  \"backend\": \"" << backend << "\",\n  \"repeat\": "
+       << repeat << ",\n  \"workloads\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& result = results[i];
+        os << (i ? ",\n" : "\n") << "    {\"name\": \"" << result.name
+           << "\", \"exit_code\": " << result.exit_code
+           << ", \"phases\": {";
+        for (int phase = 0; phase < kPhaseCount; ++phase) {
+            os << (phase ? ",\n" : "\n") << "      \"" << kPhaseNames[phase]
+               << "\": ";
+            PrintPhase(os, result.samples[phase]);
+        }
+        os << "\n    }}";
+    }
+    os << "\n  ]\n}\n";
+}
+
+}  // namespace
+
+// Usage: compiler_bench [--repeat=N] [--backend=ast|bytecode|jit]
+//                       [--inline-budget=N] [--jobs=N] [--seed=N]
+//                       [--workload-dir=DIR] [workload...]
+int main(int argc, char* argv[]) {
+    int repeat = 5;
+    Options options;
+    std::string_view backend_name = "ast";
+    std::string workload_dir = BENCH_WORKLOAD_DIR;
+    std::vector<std::string> workloads;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg(argv[i]);
+        if (arg.rfind("--repeat=", 0) == 0) {
+            repeat = std::max(1, std::atoi(argv[i] + arg.find('=') + 1));
+        } else if (arg.rfind("--backend=", 0) == 0) {
+            backend_name = arg.substr(arg.find('=') + 1);
+            auto parsed = ParseBackend(backend_name);
+            if (!parsed) {
+                std::cerr << "Unknown backend: " << arg << '\n';
+                return 1;
+            }
+            options.backend = *parsed;
+        } else if (arg.rfind("--inline-budget=", 0) == 0) {
+            options.inline_budget = std::atoi(argv[i] + arg.find('=') + 1);
+        } else if (arg.rfind("--jobs=", 0) == 0) {
+            options.jobs =
+                std::max(0, std::atoi(argv[i] + arg.find('=') + 1));
+        } else if (arg.rfind("--seed=", 0) == 0) {
+            options.seed =
+                std::strtoull(argv[i] + arg.find('=') + 1, nullptr, 10);
+        } else if (arg.rfind("--workload-dir=", 0) == 0) {
+            workload_dir = arg.substr(arg.find('=') + 1);
+        } else if (arg.size() > 1 && arg[0] == '-') {
+            std::cerr << "Unknown option: " << arg << '\n';
+            return 1;
+        } else {
+            workloads.emplace_back(arg);
+        }
+    }
+    if (workloads.empty()) {
+        workloads.assign(std::begin(kWorkloads), std::end(kWorkloads));
+    }
+
+    // Program output is written for real, but to nowhere.
+    int null_fd = open("/dev/null", O_WRONLY);
+    if (null_fd < 0) {
+        std::cerr << "Cannot open /dev/null\n";
+        return 1;
+    }
+    OutputBuffer out(null_fd, OutputBuffer::FlushPolicy::Exit);
+
+    std::vector<Result> results;
+    for (const auto& name : workloads) {
+        Result result;
+        result.name = name;
+        try {
+            SourceFile source(workload_dir + "/" + name + ".c");
+            for (int run = 0; run < repeat; ++run) {
+                RunOnce(source.Text(), options, out, &result);
+            }
+        } catch (const std::exception& ex) {
+            std::cerr << name << ": " << ex.what() << '\n';
+            return 1;
+        }
+        results.push_back(std::move(result));
+    }
+
+    PrintJson(std::cout, backend_name, repeat, results);
+    return 0;
+}
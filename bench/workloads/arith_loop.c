@@ -0,0 +1,12 @@
+int main() {
+    int i;
+    int sum;
+    i = 0;
+    sum = 0;
+    while (i < 500000) {
+        sum = (sum + i * 7 - i / 3 + i % 11) % 1000003;
+        i = i + 1;
+    }
+    print(sum);
+    return 0;
+}
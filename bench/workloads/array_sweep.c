@@ -0,0 +1,27 @@
+int data[10000];
+
+int main() {
+    int i;
+    int pass;
+    int sum;
+
+    i = 0;
+    while (i < 10000) {
+        data[i] = i % 97;
+        i = i + 1;
+    }
+
+    sum = 0;
+    pass = 0;
+    while (pass < 100) {
+        i = 1;
+        while (i < 10000) {
+            data[i] = (data[i] + data[i - 1]) % 1009;
+            i = i + 1;
+        }
+        sum = (sum + data[9999]) % 1000003;
+        pass = pass + 1;
+    }
+    print(sum);
+    return 0;
+}
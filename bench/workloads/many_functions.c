@@ -0,0 +1,9216 @@
+int f0(int n) {
+    return n + 1;
+}
+
+int f1(int n) {
+    int acc;
+    acc = f0(n) + 1;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f2(int n) {
+    int acc;
+    acc = f1(n) + 2;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f3(int n) {
+    int acc;
+    acc = f2(n) + 3;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f4(int n) {
+    int acc;
+    acc = f3(n) + 4;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f5(int n) {
+    int acc;
+    acc = f4(n) + 5;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f6(int n) {
+    int acc;
+    acc = f5(n) + 6;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f7(int n) {
+    int acc;
+    acc = f6(n) + 7;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f8(int n) {
+    int acc;
+    acc = f7(n) + 8;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f9(int n) {
+    int acc;
+    acc = f8(n) + 9;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f10(int n) {
+    int acc;
+    acc = f9(n) + 10;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f11(int n) {
+    int acc;
+    acc = f10(n) + 11;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f12(int n) {
+    int acc;
+    acc = f11(n) + 12;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f13(int n) {
+    int acc;
+    acc = f12(n) + 13;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f14(int n) {
+    int acc;
+    acc = f13(n) + 14;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f15(int n) {
+    int acc;
+    acc = f14(n) + 15;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f16(int n) {
+    int acc;
+    acc = f15(n) + 16;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f17(int n) {
+    int acc;
+    acc = f16(n) + 17;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f18(int n) {
+    int acc;
+    acc = f17(n) + 18;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f19(int n) {
+    int acc;
+    acc = f18(n) + 19;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f20(int n) {
+    int acc;
+    acc = f19(n) + 20;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f21(int n) {
+    int acc;
+    acc = f20(n) + 21;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f22(int n) {
+    int acc;
+    acc = f21(n) + 22;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f23(int n) {
+    int acc;
+    acc = f22(n) + 23;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f24(int n) {
+    int acc;
+    acc = f23(n) + 24;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f25(int n) {
+    int acc;
+    acc = f24(n) + 25;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f26(int n) {
+    int acc;
+    acc = f25(n) + 26;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f27(int n) {
+    int acc;
+    acc = f26(n) + 27;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f28(int n) {
+    int acc;
+    acc = f27(n) + 28;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f29(int n) {
+    int acc;
+    acc = f28(n) + 29;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f30(int n) {
+    int acc;
+    acc = f29(n) + 30;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f31(int n) {
+    int acc;
+    acc = f30(n) + 31;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f32(int n) {
+    int acc;
+    acc = f31(n) + 32;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f33(int n) {
+    int acc;
+    acc = f32(n) + 33;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f34(int n) {
+    int acc;
+    acc = f33(n) + 34;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f35(int n) {
+    int acc;
+    acc = f34(n) + 35;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f36(int n) {
+    int acc;
+    acc = f35(n) + 36;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f37(int n) {
+    int acc;
+    acc = f36(n) + 37;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f38(int n) {
+    int acc;
+    acc = f37(n) + 38;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f39(int n) {
+    int acc;
+    acc = f38(n) + 39;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f40(int n) {
+    int acc;
+    acc = f39(n) + 40;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f41(int n) {
+    int acc;
+    acc = f40(n) + 41;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f42(int n) {
+    int acc;
+    acc = f41(n) + 42;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f43(int n) {
+    int acc;
+    acc = f42(n) + 43;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f44(int n) {
+    int acc;
+    acc = f43(n) + 44;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f45(int n) {
+    int acc;
+    acc = f44(n) + 45;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f46(int n) {
+    int acc;
+    acc = f45(n) + 46;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f47(int n) {
+    int acc;
+    acc = f46(n) + 47;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f48(int n) {
+    int acc;
+    acc = f47(n) + 48;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f49(int n) {
+    int acc;
+    acc = f48(n) + 49;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f50(int n) {
+    int acc;
+    acc = f49(n) + 50;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f51(int n) {
+    int acc;
+    acc = f50(n) + 51;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f52(int n) {
+    int acc;
+    acc = f51(n) + 52;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f53(int n) {
+    int acc;
+    acc = f52(n) + 53;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f54(int n) {
+    int acc;
+    acc = f53(n) + 54;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f55(int n) {
+    int acc;
+    acc = f54(n) + 55;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f56(int n) {
+    int acc;
+    acc = f55(n) + 56;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f57(int n) {
+    int acc;
+    acc = f56(n) + 57;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f58(int n) {
+    int acc;
+    acc = f57(n) + 58;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f59(int n) {
+    int acc;
+    acc = f58(n) + 59;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f60(int n) {
+    int acc;
+    acc = f59(n) + 60;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f61(int n) {
+    int acc;
+    acc = f60(n) + 61;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f62(int n) {
+    int acc;
+    acc = f61(n) + 62;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f63(int n) {
+    int acc;
+    acc = f62(n) + 63;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f64(int n) {
+    int acc;
+    acc = f63(n) + 64;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f65(int n) {
+    int acc;
+    acc = f64(n) + 65;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f66(int n) {
+    int acc;
+    acc = f65(n) + 66;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f67(int n) {
+    int acc;
+    acc = f66(n) + 67;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f68(int n) {
+    int acc;
+    acc = f67(n) + 68;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f69(int n) {
+    int acc;
+    acc = f68(n) + 69;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f70(int n) {
+    int acc;
+    acc = f69(n) + 70;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f71(int n) {
+    int acc;
+    acc = f70(n) + 71;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f72(int n) {
+    int acc;
+    acc = f71(n) + 72;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f73(int n) {
+    int acc;
+    acc = f72(n) + 73;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f74(int n) {
+    int acc;
+    acc = f73(n) + 74;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f75(int n) {
+    int acc;
+    acc = f74(n) + 75;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f76(int n) {
+    int acc;
+    acc = f75(n) + 76;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f77(int n) {
+    int acc;
+    acc = f76(n) + 77;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f78(int n) {
+    int acc;
+    acc = f77(n) + 78;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f79(int n) {
+    int acc;
+    acc = f78(n) + 79;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f80(int n) {
+    int acc;
+    acc = f79(n) + 80;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f81(int n) {
+    int acc;
+    acc = f80(n) + 81;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f82(int n) {
+    int acc;
+    acc = f81(n) + 82;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f83(int n) {
+    int acc;
+    acc = f82(n) + 83;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f84(int n) {
+    int acc;
+    acc = f83(n) + 84;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f85(int n) {
+    int acc;
+    acc = f84(n) + 85;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f86(int n) {
+    int acc;
+    acc = f85(n) + 86;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f87(int n) {
+    int acc;
+    acc = f86(n) + 87;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f88(int n) {
+    int acc;
+    acc = f87(n) + 88;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f89(int n) {
+    int acc;
+    acc = f88(n) + 89;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f90(int n) {
+    int acc;
+    acc = f89(n) + 90;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f91(int n) {
+    int acc;
+    acc = f90(n) + 91;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f92(int n) {
+    int acc;
+    acc = f91(n) + 92;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f93(int n) {
+    int acc;
+    acc = f92(n) + 93;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f94(int n) {
+    int acc;
+    acc = f93(n) + 94;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f95(int n) {
+    int acc;
+    acc = f94(n) + 95;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f96(int n) {
+    int acc;
+    acc = f95(n) + 96;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f97(int n) {
+    int acc;
+    acc = f96(n) + 97;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f98(int n) {
+    int acc;
+    acc = f97(n) + 98;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f99(int n) {
+    int acc;
+    acc = f98(n) + 99;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f100(int n) {
+    int acc;
+    acc = f99(n) + 100;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f101(int n) {
+    int acc;
+    acc = f100(n) + 101;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f102(int n) {
+    int acc;
+    acc = f101(n) + 102;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f103(int n) {
+    int acc;
+    acc = f102(n) + 103;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f104(int n) {
+    int acc;
+    acc = f103(n) + 104;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f105(int n) {
+    int acc;
+    acc = f104(n) + 105;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f106(int n) {
+    int acc;
+    acc = f105(n) + 106;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f107(int n) {
+    int acc;
+    acc = f106(n) + 107;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f108(int n) {
+    int acc;
+    acc = f107(n) + 108;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f109(int n) {
+    int acc;
+    acc = f108(n) + 109;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f110(int n) {
+    int acc;
+    acc = f109(n) + 110;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f111(int n) {
+    int acc;
+    acc = f110(n) + 111;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f112(int n) {
+    int acc;
+    acc = f111(n) + 112;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f113(int n) {
+    int acc;
+    acc = f112(n) + 113;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f114(int n) {
+    int acc;
+    acc = f113(n) + 114;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f115(int n) {
+    int acc;
+    acc = f114(n) + 115;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f116(int n) {
+    int acc;
+    acc = f115(n) + 116;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f117(int n) {
+    int acc;
+    acc = f116(n) + 117;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f118(int n) {
+    int acc;
+    acc = f117(n) + 118;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f119(int n) {
+    int acc;
+    acc = f118(n) + 119;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f120(int n) {
+    int acc;
+    acc = f119(n) + 120;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f121(int n) {
+    int acc;
+    acc = f120(n) + 121;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f122(int n) {
+    int acc;
+    acc = f121(n) + 122;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f123(int n) {
+    int acc;
+    acc = f122(n) + 123;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f124(int n) {
+    int acc;
+    acc = f123(n) + 124;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f125(int n) {
+    int acc;
+    acc = f124(n) + 125;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f126(int n) {
+    int acc;
+    acc = f125(n) + 126;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f127(int n) {
+    int acc;
+    acc = f126(n) + 127;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f128(int n) {
+    int acc;
+    acc = f127(n) + 128;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f129(int n) {
+    int acc;
+    acc = f128(n) + 129;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f130(int n) {
+    int acc;
+    acc = f129(n) + 130;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f131(int n) {
+    int acc;
+    acc = f130(n) + 131;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f132(int n) {
+    int acc;
+    acc = f131(n) + 132;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f133(int n) {
+    int acc;
+    acc = f132(n) + 133;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f134(int n) {
+    int acc;
+    acc = f133(n) + 134;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f135(int n) {
+    int acc;
+    acc = f134(n) + 135;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f136(int n) {
+    int acc;
+    acc = f135(n) + 136;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f137(int n) {
+    int acc;
+    acc = f136(n) + 137;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f138(int n) {
+    int acc;
+    acc = f137(n) + 138;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f139(int n) {
+    int acc;
+    acc = f138(n) + 139;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f140(int n) {
+    int acc;
+    acc = f139(n) + 140;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f141(int n) {
+    int acc;
+    acc = f140(n) + 141;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f142(int n) {
+    int acc;
+    acc = f141(n) + 142;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f143(int n) {
+    int acc;
+    acc = f142(n) + 143;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f144(int n) {
+    int acc;
+    acc = f143(n) + 144;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f145(int n) {
+    int acc;
+    acc = f144(n) + 145;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f146(int n) {
+    int acc;
+    acc = f145(n) + 146;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f147(int n) {
+    int acc;
+    acc = f146(n) + 147;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f148(int n) {
+    int acc;
+    acc = f147(n) + 148;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f149(int n) {
+    int acc;
+    acc = f148(n) + 149;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f150(int n) {
+    int acc;
+    acc = f149(n) + 150;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f151(int n) {
+    int acc;
+    acc = f150(n) + 151;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f152(int n) {
+    int acc;
+    acc = f151(n) + 152;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f153(int n) {
+    int acc;
+    acc = f152(n) + 153;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f154(int n) {
+    int acc;
+    acc = f153(n) + 154;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f155(int n) {
+    int acc;
+    acc = f154(n) + 155;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f156(int n) {
+    int acc;
+    acc = f155(n) + 156;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f157(int n) {
+    int acc;
+    acc = f156(n) + 157;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f158(int n) {
+    int acc;
+    acc = f157(n) + 158;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f159(int n) {
+    int acc;
+    acc = f158(n) + 159;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f160(int n) {
+    int acc;
+    acc = f159(n) + 160;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f161(int n) {
+    int acc;
+    acc = f160(n) + 161;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f162(int n) {
+    int acc;
+    acc = f161(n) + 162;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f163(int n) {
+    int acc;
+    acc = f162(n) + 163;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f164(int n) {
+    int acc;
+    acc = f163(n) + 164;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f165(int n) {
+    int acc;
+    acc = f164(n) + 165;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f166(int n) {
+    int acc;
+    acc = f165(n) + 166;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f167(int n) {
+    int acc;
+    acc = f166(n) + 167;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f168(int n) {
+    int acc;
+    acc = f167(n) + 168;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f169(int n) {
+    int acc;
+    acc = f168(n) + 169;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f170(int n) {
+    int acc;
+    acc = f169(n) + 170;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f171(int n) {
+    int acc;
+    acc = f170(n) + 171;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f172(int n) {
+    int acc;
+    acc = f171(n) + 172;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f173(int n) {
+    int acc;
+    acc = f172(n) + 173;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f174(int n) {
+    int acc;
+    acc = f173(n) + 174;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f175(int n) {
+    int acc;
+    acc = f174(n) + 175;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f176(int n) {
+    int acc;
+    acc = f175(n) + 176;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f177(int n) {
+    int acc;
+    acc = f176(n) + 177;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f178(int n) {
+    int acc;
+    acc = f177(n) + 178;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f179(int n) {
+    int acc;
+    acc = f178(n) + 179;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f180(int n) {
+    int acc;
+    acc = f179(n) + 180;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f181(int n) {
+    int acc;
+    acc = f180(n) + 181;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f182(int n) {
+    int acc;
+    acc = f181(n) + 182;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f183(int n) {
+    int acc;
+    acc = f182(n) + 183;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f184(int n) {
+    int acc;
+    acc = f183(n) + 184;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f185(int n) {
+    int acc;
+    acc = f184(n) + 185;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f186(int n) {
+    int acc;
+    acc = f185(n) + 186;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f187(int n) {
+    int acc;
+    acc = f186(n) + 187;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f188(int n) {
+    int acc;
+    acc = f187(n) + 188;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f189(int n) {
+    int acc;
+    acc = f188(n) + 189;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f190(int n) {
+    int acc;
+    acc = f189(n) + 190;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f191(int n) {
+    int acc;
+    acc = f190(n) + 191;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f192(int n) {
+    int acc;
+    acc = f191(n) + 192;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f193(int n) {
+    int acc;
+    acc = f192(n) + 193;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f194(int n) {
+    int acc;
+    acc = f193(n) + 194;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f195(int n) {
+    int acc;
+    acc = f194(n) + 195;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f196(int n) {
+    int acc;
+    acc = f195(n) + 196;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f197(int n) {
+    int acc;
+    acc = f196(n) + 197;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f198(int n) {
+    int acc;
+    acc = f197(n) + 198;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f199(int n) {
+    int acc;
+    acc = f198(n) + 199;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f200(int n) {
+    int acc;
+    acc = f199(n) + 200;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f201(int n) {
+    int acc;
+    acc = f200(n) + 201;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f202(int n) {
+    int acc;
+    acc = f201(n) + 202;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f203(int n) {
+    int acc;
+    acc = f202(n) + 203;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f204(int n) {
+    int acc;
+    acc = f203(n) + 204;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f205(int n) {
+    int acc;
+    acc = f204(n) + 205;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f206(int n) {
+    int acc;
+    acc = f205(n) + 206;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f207(int n) {
+    int acc;
+    acc = f206(n) + 207;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f208(int n) {
+    int acc;
+    acc = f207(n) + 208;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f209(int n) {
+    int acc;
+    acc = f208(n) + 209;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f210(int n) {
+    int acc;
+    acc = f209(n) + 210;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f211(int n) {
+    int acc;
+    acc = f210(n) + 211;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f212(int n) {
+    int acc;
+    acc = f211(n) + 212;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f213(int n) {
+    int acc;
+    acc = f212(n) + 213;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f214(int n) {
+    int acc;
+    acc = f213(n) + 214;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f215(int n) {
+    int acc;
+    acc = f214(n) + 215;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f216(int n) {
+    int acc;
+    acc = f215(n) + 216;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f217(int n) {
+    int acc;
+    acc = f216(n) + 217;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f218(int n) {
+    int acc;
+    acc = f217(n) + 218;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f219(int n) {
+    int acc;
+    acc = f218(n) + 219;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f220(int n) {
+    int acc;
+    acc = f219(n) + 220;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f221(int n) {
+    int acc;
+    acc = f220(n) + 221;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f222(int n) {
+    int acc;
+    acc = f221(n) + 222;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f223(int n) {
+    int acc;
+    acc = f222(n) + 223;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f224(int n) {
+    int acc;
+    acc = f223(n) + 224;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f225(int n) {
+    int acc;
+    acc = f224(n) + 225;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f226(int n) {
+    int acc;
+    acc = f225(n) + 226;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f227(int n) {
+    int acc;
+    acc = f226(n) + 227;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f228(int n) {
+    int acc;
+    acc = f227(n) + 228;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f229(int n) {
+    int acc;
+    acc = f228(n) + 229;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f230(int n) {
+    int acc;
+    acc = f229(n) + 230;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f231(int n) {
+    int acc;
+    acc = f230(n) + 231;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f232(int n) {
+    int acc;
+    acc = f231(n) + 232;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f233(int n) {
+    int acc;
+    acc = f232(n) + 233;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f234(int n) {
+    int acc;
+    acc = f233(n) + 234;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f235(int n) {
+    int acc;
+    acc = f234(n) + 235;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f236(int n) {
+    int acc;
+    acc = f235(n) + 236;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f237(int n) {
+    int acc;
+    acc = f236(n) + 237;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f238(int n) {
+    int acc;
+    acc = f237(n) + 238;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f239(int n) {
+    int acc;
+    acc = f238(n) + 239;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f240(int n) {
+    int acc;
+    acc = f239(n) + 240;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f241(int n) {
+    int acc;
+    acc = f240(n) + 241;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f242(int n) {
+    int acc;
+    acc = f241(n) + 242;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f243(int n) {
+    int acc;
+    acc = f242(n) + 243;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f244(int n) {
+    int acc;
+    acc = f243(n) + 244;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f245(int n) {
+    int acc;
+    acc = f244(n) + 245;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f246(int n) {
+    int acc;
+    acc = f245(n) + 246;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f247(int n) {
+    int acc;
+    acc = f246(n) + 247;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f248(int n) {
+    int acc;
+    acc = f247(n) + 248;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f249(int n) {
+    int acc;
+    acc = f248(n) + 249;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f250(int n) {
+    int acc;
+    acc = f249(n) + 250;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f251(int n) {
+    int acc;
+    acc = f250(n) + 251;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f252(int n) {
+    int acc;
+    acc = f251(n) + 252;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f253(int n) {
+    int acc;
+    acc = f252(n) + 253;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f254(int n) {
+    int acc;
+    acc = f253(n) + 254;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f255(int n) {
+    int acc;
+    acc = f254(n) + 255;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f256(int n) {
+    int acc;
+    acc = f255(n) + 256;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f257(int n) {
+    int acc;
+    acc = f256(n) + 257;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f258(int n) {
+    int acc;
+    acc = f257(n) + 258;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f259(int n) {
+    int acc;
+    acc = f258(n) + 259;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f260(int n) {
+    int acc;
+    acc = f259(n) + 260;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f261(int n) {
+    int acc;
+    acc = f260(n) + 261;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f262(int n) {
+    int acc;
+    acc = f261(n) + 262;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f263(int n) {
+    int acc;
+    acc = f262(n) + 263;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f264(int n) {
+    int acc;
+    acc = f263(n) + 264;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f265(int n) {
+    int acc;
+    acc = f264(n) + 265;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f266(int n) {
+    int acc;
+    acc = f265(n) + 266;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f267(int n) {
+    int acc;
+    acc = f266(n) + 267;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f268(int n) {
+    int acc;
+    acc = f267(n) + 268;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f269(int n) {
+    int acc;
+    acc = f268(n) + 269;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f270(int n) {
+    int acc;
+    acc = f269(n) + 270;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f271(int n) {
+    int acc;
+    acc = f270(n) + 271;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f272(int n) {
+    int acc;
+    acc = f271(n) + 272;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f273(int n) {
+    int acc;
+    acc = f272(n) + 273;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f274(int n) {
+    int acc;
+    acc = f273(n) + 274;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f275(int n) {
+    int acc;
+    acc = f274(n) + 275;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f276(int n) {
+    int acc;
+    acc = f275(n) + 276;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f277(int n) {
+    int acc;
+    acc = f276(n) + 277;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f278(int n) {
+    int acc;
+    acc = f277(n) + 278;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f279(int n) {
+    int acc;
+    acc = f278(n) + 279;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f280(int n) {
+    int acc;
+    acc = f279(n) + 280;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f281(int n) {
+    int acc;
+    acc = f280(n) + 281;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f282(int n) {
+    int acc;
+    acc = f281(n) + 282;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f283(int n) {
+    int acc;
+    acc = f282(n) + 283;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f284(int n) {
+    int acc;
+    acc = f283(n) + 284;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f285(int n) {
+    int acc;
+    acc = f284(n) + 285;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f286(int n) {
+    int acc;
+    acc = f285(n) + 286;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f287(int n) {
+    int acc;
+    acc = f286(n) + 287;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f288(int n) {
+    int acc;
+    acc = f287(n) + 288;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f289(int n) {
+    int acc;
+    acc = f288(n) + 289;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f290(int n) {
+    int acc;
+    acc = f289(n) + 290;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f291(int n) {
+    int acc;
+    acc = f290(n) + 291;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f292(int n) {
+    int acc;
+    acc = f291(n) + 292;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f293(int n) {
+    int acc;
+    acc = f292(n) + 293;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f294(int n) {
+    int acc;
+    acc = f293(n) + 294;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f295(int n) {
+    int acc;
+    acc = f294(n) + 295;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f296(int n) {
+    int acc;
+    acc = f295(n) + 296;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f297(int n) {
+    int acc;
+    acc = f296(n) + 297;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f298(int n) {
+    int acc;
+    acc = f297(n) + 298;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f299(int n) {
+    int acc;
+    acc = f298(n) + 299;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f300(int n) {
+    int acc;
+    acc = f299(n) + 300;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f301(int n) {
+    int acc;
+    acc = f300(n) + 301;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f302(int n) {
+    int acc;
+    acc = f301(n) + 302;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f303(int n) {
+    int acc;
+    acc = f302(n) + 303;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f304(int n) {
+    int acc;
+    acc = f303(n) + 304;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f305(int n) {
+    int acc;
+    acc = f304(n) + 305;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f306(int n) {
+    int acc;
+    acc = f305(n) + 306;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f307(int n) {
+    int acc;
+    acc = f306(n) + 307;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f308(int n) {
+    int acc;
+    acc = f307(n) + 308;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f309(int n) {
+    int acc;
+    acc = f308(n) + 309;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f310(int n) {
+    int acc;
+    acc = f309(n) + 310;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f311(int n) {
+    int acc;
+    acc = f310(n) + 311;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f312(int n) {
+    int acc;
+    acc = f311(n) + 312;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f313(int n) {
+    int acc;
+    acc = f312(n) + 313;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f314(int n) {
+    int acc;
+    acc = f313(n) + 314;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f315(int n) {
+    int acc;
+    acc = f314(n) + 315;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f316(int n) {
+    int acc;
+    acc = f315(n) + 316;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f317(int n) {
+    int acc;
+    acc = f316(n) + 317;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f318(int n) {
+    int acc;
+    acc = f317(n) + 318;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f319(int n) {
+    int acc;
+    acc = f318(n) + 319;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f320(int n) {
+    int acc;
+    acc = f319(n) + 320;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f321(int n) {
+    int acc;
+    acc = f320(n) + 321;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f322(int n) {
+    int acc;
+    acc = f321(n) + 322;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f323(int n) {
+    int acc;
+    acc = f322(n) + 323;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f324(int n) {
+    int acc;
+    acc = f323(n) + 324;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f325(int n) {
+    int acc;
+    acc = f324(n) + 325;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f326(int n) {
+    int acc;
+    acc = f325(n) + 326;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f327(int n) {
+    int acc;
+    acc = f326(n) + 327;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f328(int n) {
+    int acc;
+    acc = f327(n) + 328;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f329(int n) {
+    int acc;
+    acc = f328(n) + 329;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f330(int n) {
+    int acc;
+    acc = f329(n) + 330;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f331(int n) {
+    int acc;
+    acc = f330(n) + 331;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f332(int n) {
+    int acc;
+    acc = f331(n) + 332;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f333(int n) {
+    int acc;
+    acc = f332(n) + 333;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f334(int n) {
+    int acc;
+    acc = f333(n) + 334;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f335(int n) {
+    int acc;
+    acc = f334(n) + 335;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f336(int n) {
+    int acc;
+    acc = f335(n) + 336;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f337(int n) {
+    int acc;
+    acc = f336(n) + 337;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f338(int n) {
+    int acc;
+    acc = f337(n) + 338;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f339(int n) {
+    int acc;
+    acc = f338(n) + 339;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f340(int n) {
+    int acc;
+    acc = f339(n) + 340;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f341(int n) {
+    int acc;
+    acc = f340(n) + 341;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f342(int n) {
+    int acc;
+    acc = f341(n) + 342;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f343(int n) {
+    int acc;
+    acc = f342(n) + 343;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f344(int n) {
+    int acc;
+    acc = f343(n) + 344;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f345(int n) {
+    int acc;
+    acc = f344(n) + 345;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f346(int n) {
+    int acc;
+    acc = f345(n) + 346;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f347(int n) {
+    int acc;
+    acc = f346(n) + 347;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f348(int n) {
+    int acc;
+    acc = f347(n) + 348;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f349(int n) {
+    int acc;
+    acc = f348(n) + 349;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f350(int n) {
+    int acc;
+    acc = f349(n) + 350;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f351(int n) {
+    int acc;
+    acc = f350(n) + 351;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f352(int n) {
+    int acc;
+    acc = f351(n) + 352;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f353(int n) {
+    int acc;
+    acc = f352(n) + 353;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f354(int n) {
+    int acc;
+    acc = f353(n) + 354;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f355(int n) {
+    int acc;
+    acc = f354(n) + 355;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f356(int n) {
+    int acc;
+    acc = f355(n) + 356;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f357(int n) {
+    int acc;
+    acc = f356(n) + 357;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f358(int n) {
+    int acc;
+    acc = f357(n) + 358;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f359(int n) {
+    int acc;
+    acc = f358(n) + 359;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f360(int n) {
+    int acc;
+    acc = f359(n) + 360;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f361(int n) {
+    int acc;
+    acc = f360(n) + 361;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f362(int n) {
+    int acc;
+    acc = f361(n) + 362;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f363(int n) {
+    int acc;
+    acc = f362(n) + 363;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f364(int n) {
+    int acc;
+    acc = f363(n) + 364;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f365(int n) {
+    int acc;
+    acc = f364(n) + 365;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f366(int n) {
+    int acc;
+    acc = f365(n) + 366;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f367(int n) {
+    int acc;
+    acc = f366(n) + 367;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f368(int n) {
+    int acc;
+    acc = f367(n) + 368;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f369(int n) {
+    int acc;
+    acc = f368(n) + 369;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f370(int n) {
+    int acc;
+    acc = f369(n) + 370;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f371(int n) {
+    int acc;
+    acc = f370(n) + 371;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f372(int n) {
+    int acc;
+    acc = f371(n) + 372;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f373(int n) {
+    int acc;
+    acc = f372(n) + 373;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f374(int n) {
+    int acc;
+    acc = f373(n) + 374;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f375(int n) {
+    int acc;
+    acc = f374(n) + 375;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f376(int n) {
+    int acc;
+    acc = f375(n) + 376;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f377(int n) {
+    int acc;
+    acc = f376(n) + 377;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f378(int n) {
+    int acc;
+    acc = f377(n) + 378;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f379(int n) {
+    int acc;
+    acc = f378(n) + 379;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f380(int n) {
+    int acc;
+    acc = f379(n) + 380;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f381(int n) {
+    int acc;
+    acc = f380(n) + 381;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f382(int n) {
+    int acc;
+    acc = f381(n) + 382;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f383(int n) {
+    int acc;
+    acc = f382(n) + 383;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f384(int n) {
+    int acc;
+    acc = f383(n) + 384;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f385(int n) {
+    int acc;
+    acc = f384(n) + 385;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f386(int n) {
+    int acc;
+    acc = f385(n) + 386;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f387(int n) {
+    int acc;
+    acc = f386(n) + 387;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f388(int n) {
+    int acc;
+    acc = f387(n) + 388;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f389(int n) {
+    int acc;
+    acc = f388(n) + 389;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f390(int n) {
+    int acc;
+    acc = f389(n) + 390;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f391(int n) {
+    int acc;
+    acc = f390(n) + 391;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f392(int n) {
+    int acc;
+    acc = f391(n) + 392;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f393(int n) {
+    int acc;
+    acc = f392(n) + 393;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f394(int n) {
+    int acc;
+    acc = f393(n) + 394;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f395(int n) {
+    int acc;
+    acc = f394(n) + 395;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f396(int n) {
+    int acc;
+    acc = f395(n) + 396;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f397(int n) {
+    int acc;
+    acc = f396(n) + 397;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f398(int n) {
+    int acc;
+    acc = f397(n) + 398;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f399(int n) {
+    int acc;
+    acc = f398(n) + 399;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f400(int n) {
+    int acc;
+    acc = f399(n) + 400;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f401(int n) {
+    int acc;
+    acc = f400(n) + 401;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f402(int n) {
+    int acc;
+    acc = f401(n) + 402;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f403(int n) {
+    int acc;
+    acc = f402(n) + 403;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f404(int n) {
+    int acc;
+    acc = f403(n) + 404;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f405(int n) {
+    int acc;
+    acc = f404(n) + 405;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f406(int n) {
+    int acc;
+    acc = f405(n) + 406;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f407(int n) {
+    int acc;
+    acc = f406(n) + 407;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f408(int n) {
+    int acc;
+    acc = f407(n) + 408;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f409(int n) {
+    int acc;
+    acc = f408(n) + 409;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f410(int n) {
+    int acc;
+    acc = f409(n) + 410;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f411(int n) {
+    int acc;
+    acc = f410(n) + 411;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f412(int n) {
+    int acc;
+    acc = f411(n) + 412;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f413(int n) {
+    int acc;
+    acc = f412(n) + 413;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f414(int n) {
+    int acc;
+    acc = f413(n) + 414;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f415(int n) {
+    int acc;
+    acc = f414(n) + 415;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f416(int n) {
+    int acc;
+    acc = f415(n) + 416;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f417(int n) {
+    int acc;
+    acc = f416(n) + 417;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f418(int n) {
+    int acc;
+    acc = f417(n) + 418;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f419(int n) {
+    int acc;
+    acc = f418(n) + 419;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f420(int n) {
+    int acc;
+    acc = f419(n) + 420;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f421(int n) {
+    int acc;
+    acc = f420(n) + 421;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f422(int n) {
+    int acc;
+    acc = f421(n) + 422;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f423(int n) {
+    int acc;
+    acc = f422(n) + 423;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f424(int n) {
+    int acc;
+    acc = f423(n) + 424;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f425(int n) {
+    int acc;
+    acc = f424(n) + 425;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f426(int n) {
+    int acc;
+    acc = f425(n) + 426;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f427(int n) {
+    int acc;
+    acc = f426(n) + 427;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f428(int n) {
+    int acc;
+    acc = f427(n) + 428;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f429(int n) {
+    int acc;
+    acc = f428(n) + 429;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f430(int n) {
+    int acc;
+    acc = f429(n) + 430;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f431(int n) {
+    int acc;
+    acc = f430(n) + 431;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f432(int n) {
+    int acc;
+    acc = f431(n) + 432;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f433(int n) {
+    int acc;
+    acc = f432(n) + 433;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f434(int n) {
+    int acc;
+    acc = f433(n) + 434;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f435(int n) {
+    int acc;
+    acc = f434(n) + 435;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f436(int n) {
+    int acc;
+    acc = f435(n) + 436;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f437(int n) {
+    int acc;
+    acc = f436(n) + 437;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f438(int n) {
+    int acc;
+    acc = f437(n) + 438;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f439(int n) {
+    int acc;
+    acc = f438(n) + 439;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f440(int n) {
+    int acc;
+    acc = f439(n) + 440;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f441(int n) {
+    int acc;
+    acc = f440(n) + 441;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f442(int n) {
+    int acc;
+    acc = f441(n) + 442;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f443(int n) {
+    int acc;
+    acc = f442(n) + 443;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f444(int n) {
+    int acc;
+    acc = f443(n) + 444;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f445(int n) {
+    int acc;
+    acc = f444(n) + 445;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f446(int n) {
+    int acc;
+    acc = f445(n) + 446;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f447(int n) {
+    int acc;
+    acc = f446(n) + 447;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f448(int n) {
+    int acc;
+    acc = f447(n) + 448;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f449(int n) {
+    int acc;
+    acc = f448(n) + 449;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f450(int n) {
+    int acc;
+    acc = f449(n) + 450;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f451(int n) {
+    int acc;
+    acc = f450(n) + 451;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f452(int n) {
+    int acc;
+    acc = f451(n) + 452;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f453(int n) {
+    int acc;
+    acc = f452(n) + 453;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f454(int n) {
+    int acc;
+    acc = f453(n) + 454;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f455(int n) {
+    int acc;
+    acc = f454(n) + 455;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f456(int n) {
+    int acc;
+    acc = f455(n) + 456;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f457(int n) {
+    int acc;
+    acc = f456(n) + 457;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f458(int n) {
+    int acc;
+    acc = f457(n) + 458;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f459(int n) {
+    int acc;
+    acc = f458(n) + 459;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f460(int n) {
+    int acc;
+    acc = f459(n) + 460;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f461(int n) {
+    int acc;
+    acc = f460(n) + 461;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f462(int n) {
+    int acc;
+    acc = f461(n) + 462;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f463(int n) {
+    int acc;
+    acc = f462(n) + 463;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f464(int n) {
+    int acc;
+    acc = f463(n) + 464;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f465(int n) {
+    int acc;
+    acc = f464(n) + 465;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f466(int n) {
+    int acc;
+    acc = f465(n) + 466;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f467(int n) {
+    int acc;
+    acc = f466(n) + 467;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f468(int n) {
+    int acc;
+    acc = f467(n) + 468;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f469(int n) {
+    int acc;
+    acc = f468(n) + 469;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f470(int n) {
+    int acc;
+    acc = f469(n) + 470;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f471(int n) {
+    int acc;
+    acc = f470(n) + 471;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f472(int n) {
+    int acc;
+    acc = f471(n) + 472;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f473(int n) {
+    int acc;
+    acc = f472(n) + 473;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f474(int n) {
+    int acc;
+    acc = f473(n) + 474;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f475(int n) {
+    int acc;
+    acc = f474(n) + 475;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f476(int n) {
+    int acc;
+    acc = f475(n) + 476;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f477(int n) {
+    int acc;
+    acc = f476(n) + 477;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f478(int n) {
+    int acc;
+    acc = f477(n) + 478;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f479(int n) {
+    int acc;
+    acc = f478(n) + 479;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f480(int n) {
+    int acc;
+    acc = f479(n) + 480;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f481(int n) {
+    int acc;
+    acc = f480(n) + 481;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f482(int n) {
+    int acc;
+    acc = f481(n) + 482;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f483(int n) {
+    int acc;
+    acc = f482(n) + 483;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f484(int n) {
+    int acc;
+    acc = f483(n) + 484;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f485(int n) {
+    int acc;
+    acc = f484(n) + 485;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f486(int n) {
+    int acc;
+    acc = f485(n) + 486;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f487(int n) {
+    int acc;
+    acc = f486(n) + 487;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f488(int n) {
+    int acc;
+    acc = f487(n) + 488;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f489(int n) {
+    int acc;
+    acc = f488(n) + 489;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f490(int n) {
+    int acc;
+    acc = f489(n) + 490;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f491(int n) {
+    int acc;
+    acc = f490(n) + 491;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f492(int n) {
+    int acc;
+    acc = f491(n) + 492;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f493(int n) {
+    int acc;
+    acc = f492(n) + 493;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f494(int n) {
+    int acc;
+    acc = f493(n) + 494;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f495(int n) {
+    int acc;
+    acc = f494(n) + 495;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f496(int n) {
+    int acc;
+    acc = f495(n) + 496;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f497(int n) {
+    int acc;
+    acc = f496(n) + 497;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f498(int n) {
+    int acc;
+    acc = f497(n) + 498;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f499(int n) {
+    int acc;
+    acc = f498(n) + 499;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f500(int n) {
+    int acc;
+    acc = f499(n) + 500;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f501(int n) {
+    int acc;
+    acc = f500(n) + 501;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f502(int n) {
+    int acc;
+    acc = f501(n) + 502;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f503(int n) {
+    int acc;
+    acc = f502(n) + 503;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f504(int n) {
+    int acc;
+    acc = f503(n) + 504;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f505(int n) {
+    int acc;
+    acc = f504(n) + 505;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f506(int n) {
+    int acc;
+    acc = f505(n) + 506;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f507(int n) {
+    int acc;
+    acc = f506(n) + 507;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f508(int n) {
+    int acc;
+    acc = f507(n) + 508;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f509(int n) {
+    int acc;
+    acc = f508(n) + 509;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f510(int n) {
+    int acc;
+    acc = f509(n) + 510;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f511(int n) {
+    int acc;
+    acc = f510(n) + 511;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f512(int n) {
+    int acc;
+    acc = f511(n) + 512;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f513(int n) {
+    int acc;
+    acc = f512(n) + 513;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f514(int n) {
+    int acc;
+    acc = f513(n) + 514;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f515(int n) {
+    int acc;
+    acc = f514(n) + 515;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f516(int n) {
+    int acc;
+    acc = f515(n) + 516;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f517(int n) {
+    int acc;
+    acc = f516(n) + 517;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f518(int n) {
+    int acc;
+    acc = f517(n) + 518;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f519(int n) {
+    int acc;
+    acc = f518(n) + 519;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f520(int n) {
+    int acc;
+    acc = f519(n) + 520;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f521(int n) {
+    int acc;
+    acc = f520(n) + 521;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f522(int n) {
+    int acc;
+    acc = f521(n) + 522;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f523(int n) {
+    int acc;
+    acc = f522(n) + 523;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f524(int n) {
+    int acc;
+    acc = f523(n) + 524;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f525(int n) {
+    int acc;
+    acc = f524(n) + 525;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f526(int n) {
+    int acc;
+    acc = f525(n) + 526;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f527(int n) {
+    int acc;
+    acc = f526(n) + 527;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f528(int n) {
+    int acc;
+    acc = f527(n) + 528;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f529(int n) {
+    int acc;
+    acc = f528(n) + 529;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f530(int n) {
+    int acc;
+    acc = f529(n) + 530;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f531(int n) {
+    int acc;
+    acc = f530(n) + 531;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f532(int n) {
+    int acc;
+    acc = f531(n) + 532;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f533(int n) {
+    int acc;
+    acc = f532(n) + 533;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f534(int n) {
+    int acc;
+    acc = f533(n) + 534;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f535(int n) {
+    int acc;
+    acc = f534(n) + 535;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f536(int n) {
+    int acc;
+    acc = f535(n) + 536;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f537(int n) {
+    int acc;
+    acc = f536(n) + 537;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f538(int n) {
+    int acc;
+    acc = f537(n) + 538;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f539(int n) {
+    int acc;
+    acc = f538(n) + 539;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f540(int n) {
+    int acc;
+    acc = f539(n) + 540;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f541(int n) {
+    int acc;
+    acc = f540(n) + 541;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f542(int n) {
+    int acc;
+    acc = f541(n) + 542;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f543(int n) {
+    int acc;
+    acc = f542(n) + 543;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f544(int n) {
+    int acc;
+    acc = f543(n) + 544;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f545(int n) {
+    int acc;
+    acc = f544(n) + 545;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f546(int n) {
+    int acc;
+    acc = f545(n) + 546;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f547(int n) {
+    int acc;
+    acc = f546(n) + 547;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f548(int n) {
+    int acc;
+    acc = f547(n) + 548;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f549(int n) {
+    int acc;
+    acc = f548(n) + 549;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f550(int n) {
+    int acc;
+    acc = f549(n) + 550;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f551(int n) {
+    int acc;
+    acc = f550(n) + 551;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f552(int n) {
+    int acc;
+    acc = f551(n) + 552;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f553(int n) {
+    int acc;
+    acc = f552(n) + 553;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f554(int n) {
+    int acc;
+    acc = f553(n) + 554;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f555(int n) {
+    int acc;
+    acc = f554(n) + 555;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f556(int n) {
+    int acc;
+    acc = f555(n) + 556;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f557(int n) {
+    int acc;
+    acc = f556(n) + 557;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f558(int n) {
+    int acc;
+    acc = f557(n) + 558;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f559(int n) {
+    int acc;
+    acc = f558(n) + 559;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f560(int n) {
+    int acc;
+    acc = f559(n) + 560;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f561(int n) {
+    int acc;
+    acc = f560(n) + 561;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f562(int n) {
+    int acc;
+    acc = f561(n) + 562;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f563(int n) {
+    int acc;
+    acc = f562(n) + 563;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f564(int n) {
+    int acc;
+    acc = f563(n) + 564;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f565(int n) {
+    int acc;
+    acc = f564(n) + 565;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f566(int n) {
+    int acc;
+    acc = f565(n) + 566;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f567(int n) {
+    int acc;
+    acc = f566(n) + 567;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f568(int n) {
+    int acc;
+    acc = f567(n) + 568;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f569(int n) {
+    int acc;
+    acc = f568(n) + 569;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f570(int n) {
+    int acc;
+    acc = f569(n) + 570;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f571(int n) {
+    int acc;
+    acc = f570(n) + 571;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f572(int n) {
+    int acc;
+    acc = f571(n) + 572;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f573(int n) {
+    int acc;
+    acc = f572(n) + 573;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f574(int n) {
+    int acc;
+    acc = f573(n) + 574;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f575(int n) {
+    int acc;
+    acc = f574(n) + 575;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f576(int n) {
+    int acc;
+    acc = f575(n) + 576;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f577(int n) {
+    int acc;
+    acc = f576(n) + 577;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f578(int n) {
+    int acc;
+    acc = f577(n) + 578;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f579(int n) {
+    int acc;
+    acc = f578(n) + 579;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f580(int n) {
+    int acc;
+    acc = f579(n) + 580;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f581(int n) {
+    int acc;
+    acc = f580(n) + 581;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f582(int n) {
+    int acc;
+    acc = f581(n) + 582;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f583(int n) {
+    int acc;
+    acc = f582(n) + 583;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f584(int n) {
+    int acc;
+    acc = f583(n) + 584;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f585(int n) {
+    int acc;
+    acc = f584(n) + 585;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f586(int n) {
+    int acc;
+    acc = f585(n) + 586;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f587(int n) {
+    int acc;
+    acc = f586(n) + 587;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f588(int n) {
+    int acc;
+    acc = f587(n) + 588;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f589(int n) {
+    int acc;
+    acc = f588(n) + 589;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f590(int n) {
+    int acc;
+    acc = f589(n) + 590;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f591(int n) {
+    int acc;
+    acc = f590(n) + 591;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f592(int n) {
+    int acc;
+    acc = f591(n) + 592;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f593(int n) {
+    int acc;
+    acc = f592(n) + 593;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f594(int n) {
+    int acc;
+    acc = f593(n) + 594;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f595(int n) {
+    int acc;
+    acc = f594(n) + 595;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f596(int n) {
+    int acc;
+    acc = f595(n) + 596;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f597(int n) {
+    int acc;
+    acc = f596(n) + 597;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f598(int n) {
+    int acc;
+    acc = f597(n) + 598;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f599(int n) {
+    int acc;
+    acc = f598(n) + 599;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f600(int n) {
+    int acc;
+    acc = f599(n) + 600;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f601(int n) {
+    int acc;
+    acc = f600(n) + 601;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f602(int n) {
+    int acc;
+    acc = f601(n) + 602;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f603(int n) {
+    int acc;
+    acc = f602(n) + 603;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f604(int n) {
+    int acc;
+    acc = f603(n) + 604;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f605(int n) {
+    int acc;
+    acc = f604(n) + 605;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f606(int n) {
+    int acc;
+    acc = f605(n) + 606;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f607(int n) {
+    int acc;
+    acc = f606(n) + 607;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f608(int n) {
+    int acc;
+    acc = f607(n) + 608;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f609(int n) {
+    int acc;
+    acc = f608(n) + 609;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f610(int n) {
+    int acc;
+    acc = f609(n) + 610;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f611(int n) {
+    int acc;
+    acc = f610(n) + 611;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f612(int n) {
+    int acc;
+    acc = f611(n) + 612;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f613(int n) {
+    int acc;
+    acc = f612(n) + 613;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f614(int n) {
+    int acc;
+    acc = f613(n) + 614;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f615(int n) {
+    int acc;
+    acc = f614(n) + 615;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f616(int n) {
+    int acc;
+    acc = f615(n) + 616;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f617(int n) {
+    int acc;
+    acc = f616(n) + 617;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f618(int n) {
+    int acc;
+    acc = f617(n) + 618;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f619(int n) {
+    int acc;
+    acc = f618(n) + 619;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f620(int n) {
+    int acc;
+    acc = f619(n) + 620;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f621(int n) {
+    int acc;
+    acc = f620(n) + 621;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f622(int n) {
+    int acc;
+    acc = f621(n) + 622;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f623(int n) {
+    int acc;
+    acc = f622(n) + 623;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f624(int n) {
+    int acc;
+    acc = f623(n) + 624;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f625(int n) {
+    int acc;
+    acc = f624(n) + 625;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f626(int n) {
+    int acc;
+    acc = f625(n) + 626;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f627(int n) {
+    int acc;
+    acc = f626(n) + 627;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f628(int n) {
+    int acc;
+    acc = f627(n) + 628;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f629(int n) {
+    int acc;
+    acc = f628(n) + 629;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f630(int n) {
+    int acc;
+    acc = f629(n) + 630;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f631(int n) {
+    int acc;
+    acc = f630(n) + 631;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f632(int n) {
+    int acc;
+    acc = f631(n) + 632;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f633(int n) {
+    int acc;
+    acc = f632(n) + 633;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f634(int n) {
+    int acc;
+    acc = f633(n) + 634;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f635(int n) {
+    int acc;
+    acc = f634(n) + 635;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f636(int n) {
+    int acc;
+    acc = f635(n) + 636;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f637(int n) {
+    int acc;
+    acc = f636(n) + 637;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f638(int n) {
+    int acc;
+    acc = f637(n) + 638;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f639(int n) {
+    int acc;
+    acc = f638(n) + 639;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f640(int n) {
+    int acc;
+    acc = f639(n) + 640;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f641(int n) {
+    int acc;
+    acc = f640(n) + 641;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f642(int n) {
+    int acc;
+    acc = f641(n) + 642;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f643(int n) {
+    int acc;
+    acc = f642(n) + 643;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f644(int n) {
+    int acc;
+    acc = f643(n) + 644;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f645(int n) {
+    int acc;
+    acc = f644(n) + 645;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f646(int n) {
+    int acc;
+    acc = f645(n) + 646;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f647(int n) {
+    int acc;
+    acc = f646(n) + 647;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f648(int n) {
+    int acc;
+    acc = f647(n) + 648;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f649(int n) {
+    int acc;
+    acc = f648(n) + 649;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f650(int n) {
+    int acc;
+    acc = f649(n) + 650;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f651(int n) {
+    int acc;
+    acc = f650(n) + 651;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f652(int n) {
+    int acc;
+    acc = f651(n) + 652;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f653(int n) {
+    int acc;
+    acc = f652(n) + 653;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f654(int n) {
+    int acc;
+    acc = f653(n) + 654;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f655(int n) {
+    int acc;
+    acc = f654(n) + 655;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f656(int n) {
+    int acc;
+    acc = f655(n) + 656;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f657(int n) {
+    int acc;
+    acc = f656(n) + 657;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f658(int n) {
+    int acc;
+    acc = f657(n) + 658;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f659(int n) {
+    int acc;
+    acc = f658(n) + 659;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f660(int n) {
+    int acc;
+    acc = f659(n) + 660;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f661(int n) {
+    int acc;
+    acc = f660(n) + 661;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f662(int n) {
+    int acc;
+    acc = f661(n) + 662;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f663(int n) {
+    int acc;
+    acc = f662(n) + 663;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f664(int n) {
+    int acc;
+    acc = f663(n) + 664;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f665(int n) {
+    int acc;
+    acc = f664(n) + 665;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f666(int n) {
+    int acc;
+    acc = f665(n) + 666;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f667(int n) {
+    int acc;
+    acc = f666(n) + 667;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f668(int n) {
+    int acc;
+    acc = f667(n) + 668;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f669(int n) {
+    int acc;
+    acc = f668(n) + 669;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f670(int n) {
+    int acc;
+    acc = f669(n) + 670;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f671(int n) {
+    int acc;
+    acc = f670(n) + 671;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f672(int n) {
+    int acc;
+    acc = f671(n) + 672;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f673(int n) {
+    int acc;
+    acc = f672(n) + 673;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f674(int n) {
+    int acc;
+    acc = f673(n) + 674;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f675(int n) {
+    int acc;
+    acc = f674(n) + 675;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f676(int n) {
+    int acc;
+    acc = f675(n) + 676;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f677(int n) {
+    int acc;
+    acc = f676(n) + 677;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f678(int n) {
+    int acc;
+    acc = f677(n) + 678;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f679(int n) {
+    int acc;
+    acc = f678(n) + 679;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f680(int n) {
+    int acc;
+    acc = f679(n) + 680;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f681(int n) {
+    int acc;
+    acc = f680(n) + 681;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f682(int n) {
+    int acc;
+    acc = f681(n) + 682;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f683(int n) {
+    int acc;
+    acc = f682(n) + 683;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f684(int n) {
+    int acc;
+    acc = f683(n) + 684;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f685(int n) {
+    int acc;
+    acc = f684(n) + 685;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f686(int n) {
+    int acc;
+    acc = f685(n) + 686;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f687(int n) {
+    int acc;
+    acc = f686(n) + 687;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f688(int n) {
+    int acc;
+    acc = f687(n) + 688;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f689(int n) {
+    int acc;
+    acc = f688(n) + 689;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f690(int n) {
+    int acc;
+    acc = f689(n) + 690;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f691(int n) {
+    int acc;
+    acc = f690(n) + 691;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f692(int n) {
+    int acc;
+    acc = f691(n) + 692;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f693(int n) {
+    int acc;
+    acc = f692(n) + 693;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f694(int n) {
+    int acc;
+    acc = f693(n) + 694;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f695(int n) {
+    int acc;
+    acc = f694(n) + 695;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f696(int n) {
+    int acc;
+    acc = f695(n) + 696;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f697(int n) {
+    int acc;
+    acc = f696(n) + 697;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f698(int n) {
+    int acc;
+    acc = f697(n) + 698;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f699(int n) {
+    int acc;
+    acc = f698(n) + 699;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f700(int n) {
+    int acc;
+    acc = f699(n) + 700;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f701(int n) {
+    int acc;
+    acc = f700(n) + 701;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f702(int n) {
+    int acc;
+    acc = f701(n) + 702;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f703(int n) {
+    int acc;
+    acc = f702(n) + 703;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f704(int n) {
+    int acc;
+    acc = f703(n) + 704;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f705(int n) {
+    int acc;
+    acc = f704(n) + 705;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f706(int n) {
+    int acc;
+    acc = f705(n) + 706;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f707(int n) {
+    int acc;
+    acc = f706(n) + 707;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f708(int n) {
+    int acc;
+    acc = f707(n) + 708;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f709(int n) {
+    int acc;
+    acc = f708(n) + 709;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f710(int n) {
+    int acc;
+    acc = f709(n) + 710;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f711(int n) {
+    int acc;
+    acc = f710(n) + 711;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f712(int n) {
+    int acc;
+    acc = f711(n) + 712;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f713(int n) {
+    int acc;
+    acc = f712(n) + 713;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f714(int n) {
+    int acc;
+    acc = f713(n) + 714;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f715(int n) {
+    int acc;
+    acc = f714(n) + 715;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f716(int n) {
+    int acc;
+    acc = f715(n) + 716;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f717(int n) {
+    int acc;
+    acc = f716(n) + 717;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f718(int n) {
+    int acc;
+    acc = f717(n) + 718;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f719(int n) {
+    int acc;
+    acc = f718(n) + 719;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f720(int n) {
+    int acc;
+    acc = f719(n) + 720;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f721(int n) {
+    int acc;
+    acc = f720(n) + 721;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f722(int n) {
+    int acc;
+    acc = f721(n) + 722;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f723(int n) {
+    int acc;
+    acc = f722(n) + 723;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f724(int n) {
+    int acc;
+    acc = f723(n) + 724;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f725(int n) {
+    int acc;
+    acc = f724(n) + 725;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f726(int n) {
+    int acc;
+    acc = f725(n) + 726;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f727(int n) {
+    int acc;
+    acc = f726(n) + 727;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f728(int n) {
+    int acc;
+    acc = f727(n) + 728;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f729(int n) {
+    int acc;
+    acc = f728(n) + 729;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f730(int n) {
+    int acc;
+    acc = f729(n) + 730;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f731(int n) {
+    int acc;
+    acc = f730(n) + 731;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f732(int n) {
+    int acc;
+    acc = f731(n) + 732;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f733(int n) {
+    int acc;
+    acc = f732(n) + 733;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f734(int n) {
+    int acc;
+    acc = f733(n) + 734;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f735(int n) {
+    int acc;
+    acc = f734(n) + 735;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f736(int n) {
+    int acc;
+    acc = f735(n) + 736;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f737(int n) {
+    int acc;
+    acc = f736(n) + 737;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f738(int n) {
+    int acc;
+    acc = f737(n) + 738;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f739(int n) {
+    int acc;
+    acc = f738(n) + 739;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f740(int n) {
+    int acc;
+    acc = f739(n) + 740;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f741(int n) {
+    int acc;
+    acc = f740(n) + 741;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f742(int n) {
+    int acc;
+    acc = f741(n) + 742;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f743(int n) {
+    int acc;
+    acc = f742(n) + 743;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f744(int n) {
+    int acc;
+    acc = f743(n) + 744;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f745(int n) {
+    int acc;
+    acc = f744(n) + 745;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f746(int n) {
+    int acc;
+    acc = f745(n) + 746;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f747(int n) {
+    int acc;
+    acc = f746(n) + 747;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f748(int n) {
+    int acc;
+    acc = f747(n) + 748;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f749(int n) {
+    int acc;
+    acc = f748(n) + 749;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f750(int n) {
+    int acc;
+    acc = f749(n) + 750;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f751(int n) {
+    int acc;
+    acc = f750(n) + 751;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f752(int n) {
+    int acc;
+    acc = f751(n) + 752;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f753(int n) {
+    int acc;
+    acc = f752(n) + 753;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f754(int n) {
+    int acc;
+    acc = f753(n) + 754;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f755(int n) {
+    int acc;
+    acc = f754(n) + 755;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f756(int n) {
+    int acc;
+    acc = f755(n) + 756;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f757(int n) {
+    int acc;
+    acc = f756(n) + 757;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f758(int n) {
+    int acc;
+    acc = f757(n) + 758;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f759(int n) {
+    int acc;
+    acc = f758(n) + 759;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f760(int n) {
+    int acc;
+    acc = f759(n) + 760;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f761(int n) {
+    int acc;
+    acc = f760(n) + 761;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f762(int n) {
+    int acc;
+    acc = f761(n) + 762;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f763(int n) {
+    int acc;
+    acc = f762(n) + 763;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f764(int n) {
+    int acc;
+    acc = f763(n) + 764;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f765(int n) {
+    int acc;
+    acc = f764(n) + 765;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f766(int n) {
+    int acc;
+    acc = f765(n) + 766;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f767(int n) {
+    int acc;
+    acc = f766(n) + 767;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f768(int n) {
+    int acc;
+    acc = f767(n) + 768;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f769(int n) {
+    int acc;
+    acc = f768(n) + 769;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f770(int n) {
+    int acc;
+    acc = f769(n) + 770;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f771(int n) {
+    int acc;
+    acc = f770(n) + 771;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f772(int n) {
+    int acc;
+    acc = f771(n) + 772;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f773(int n) {
+    int acc;
+    acc = f772(n) + 773;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f774(int n) {
+    int acc;
+    acc = f773(n) + 774;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f775(int n) {
+    int acc;
+    acc = f774(n) + 775;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f776(int n) {
+    int acc;
+    acc = f775(n) + 776;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f777(int n) {
+    int acc;
+    acc = f776(n) + 777;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f778(int n) {
+    int acc;
+    acc = f777(n) + 778;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f779(int n) {
+    int acc;
+    acc = f778(n) + 779;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f780(int n) {
+    int acc;
+    acc = f779(n) + 780;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f781(int n) {
+    int acc;
+    acc = f780(n) + 781;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f782(int n) {
+    int acc;
+    acc = f781(n) + 782;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f783(int n) {
+    int acc;
+    acc = f782(n) + 783;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f784(int n) {
+    int acc;
+    acc = f783(n) + 784;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f785(int n) {
+    int acc;
+    acc = f784(n) + 785;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f786(int n) {
+    int acc;
+    acc = f785(n) + 786;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f787(int n) {
+    int acc;
+    acc = f786(n) + 787;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f788(int n) {
+    int acc;
+    acc = f787(n) + 788;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f789(int n) {
+    int acc;
+    acc = f788(n) + 789;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f790(int n) {
+    int acc;
+    acc = f789(n) + 790;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f791(int n) {
+    int acc;
+    acc = f790(n) + 791;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f792(int n) {
+    int acc;
+    acc = f791(n) + 792;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f793(int n) {
+    int acc;
+    acc = f792(n) + 793;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f794(int n) {
+    int acc;
+    acc = f793(n) + 794;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f795(int n) {
+    int acc;
+    acc = f794(n) + 795;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f796(int n) {
+    int acc;
+    acc = f795(n) + 796;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f797(int n) {
+    int acc;
+    acc = f796(n) + 797;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f798(int n) {
+    int acc;
+    acc = f797(n) + 798;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f799(int n) {
+    int acc;
+    acc = f798(n) + 799;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f800(int n) {
+    int acc;
+    acc = f799(n) + 800;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f801(int n) {
+    int acc;
+    acc = f800(n) + 801;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f802(int n) {
+    int acc;
+    acc = f801(n) + 802;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f803(int n) {
+    int acc;
+    acc = f802(n) + 803;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f804(int n) {
+    int acc;
+    acc = f803(n) + 804;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f805(int n) {
+    int acc;
+    acc = f804(n) + 805;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f806(int n) {
+    int acc;
+    acc = f805(n) + 806;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f807(int n) {
+    int acc;
+    acc = f806(n) + 807;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f808(int n) {
+    int acc;
+    acc = f807(n) + 808;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f809(int n) {
+    int acc;
+    acc = f808(n) + 809;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f810(int n) {
+    int acc;
+    acc = f809(n) + 810;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f811(int n) {
+    int acc;
+    acc = f810(n) + 811;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f812(int n) {
+    int acc;
+    acc = f811(n) + 812;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f813(int n) {
+    int acc;
+    acc = f812(n) + 813;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f814(int n) {
+    int acc;
+    acc = f813(n) + 814;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f815(int n) {
+    int acc;
+    acc = f814(n) + 815;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f816(int n) {
+    int acc;
+    acc = f815(n) + 816;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f817(int n) {
+    int acc;
+    acc = f816(n) + 817;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f818(int n) {
+    int acc;
+    acc = f817(n) + 818;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f819(int n) {
+    int acc;
+    acc = f818(n) + 819;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f820(int n) {
+    int acc;
+    acc = f819(n) + 820;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f821(int n) {
+    int acc;
+    acc = f820(n) + 821;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f822(int n) {
+    int acc;
+    acc = f821(n) + 822;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f823(int n) {
+    int acc;
+    acc = f822(n) + 823;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f824(int n) {
+    int acc;
+    acc = f823(n) + 824;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f825(int n) {
+    int acc;
+    acc = f824(n) + 825;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f826(int n) {
+    int acc;
+    acc = f825(n) + 826;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f827(int n) {
+    int acc;
+    acc = f826(n) + 827;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f828(int n) {
+    int acc;
+    acc = f827(n) + 828;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f829(int n) {
+    int acc;
+    acc = f828(n) + 829;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f830(int n) {
+    int acc;
+    acc = f829(n) + 830;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f831(int n) {
+    int acc;
+    acc = f830(n) + 831;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f832(int n) {
+    int acc;
+    acc = f831(n) + 832;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f833(int n) {
+    int acc;
+    acc = f832(n) + 833;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f834(int n) {
+    int acc;
+    acc = f833(n) + 834;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f835(int n) {
+    int acc;
+    acc = f834(n) + 835;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f836(int n) {
+    int acc;
+    acc = f835(n) + 836;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f837(int n) {
+    int acc;
+    acc = f836(n) + 837;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f838(int n) {
+    int acc;
+    acc = f837(n) + 838;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f839(int n) {
+    int acc;
+    acc = f838(n) + 839;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f840(int n) {
+    int acc;
+    acc = f839(n) + 840;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f841(int n) {
+    int acc;
+    acc = f840(n) + 841;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f842(int n) {
+    int acc;
+    acc = f841(n) + 842;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f843(int n) {
+    int acc;
+    acc = f842(n) + 843;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f844(int n) {
+    int acc;
+    acc = f843(n) + 844;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f845(int n) {
+    int acc;
+    acc = f844(n) + 845;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f846(int n) {
+    int acc;
+    acc = f845(n) + 846;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f847(int n) {
+    int acc;
+    acc = f846(n) + 847;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f848(int n) {
+    int acc;
+    acc = f847(n) + 848;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f849(int n) {
+    int acc;
+    acc = f848(n) + 849;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f850(int n) {
+    int acc;
+    acc = f849(n) + 850;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f851(int n) {
+    int acc;
+    acc = f850(n) + 851;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f852(int n) {
+    int acc;
+    acc = f851(n) + 852;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f853(int n) {
+    int acc;
+    acc = f852(n) + 853;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f854(int n) {
+    int acc;
+    acc = f853(n) + 854;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f855(int n) {
+    int acc;
+    acc = f854(n) + 855;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f856(int n) {
+    int acc;
+    acc = f855(n) + 856;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f857(int n) {
+    int acc;
+    acc = f856(n) + 857;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f858(int n) {
+    int acc;
+    acc = f857(n) + 858;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f859(int n) {
+    int acc;
+    acc = f858(n) + 859;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f860(int n) {
+    int acc;
+    acc = f859(n) + 860;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f861(int n) {
+    int acc;
+    acc = f860(n) + 861;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f862(int n) {
+    int acc;
+    acc = f861(n) + 862;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f863(int n) {
+    int acc;
+    acc = f862(n) + 863;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f864(int n) {
+    int acc;
+    acc = f863(n) + 864;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f865(int n) {
+    int acc;
+    acc = f864(n) + 865;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f866(int n) {
+    int acc;
+    acc = f865(n) + 866;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f867(int n) {
+    int acc;
+    acc = f866(n) + 867;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f868(int n) {
+    int acc;
+    acc = f867(n) + 868;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f869(int n) {
+    int acc;
+    acc = f868(n) + 869;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f870(int n) {
+    int acc;
+    acc = f869(n) + 870;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f871(int n) {
+    int acc;
+    acc = f870(n) + 871;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f872(int n) {
+    int acc;
+    acc = f871(n) + 872;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f873(int n) {
+    int acc;
+    acc = f872(n) + 873;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f874(int n) {
+    int acc;
+    acc = f873(n) + 874;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f875(int n) {
+    int acc;
+    acc = f874(n) + 875;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f876(int n) {
+    int acc;
+    acc = f875(n) + 876;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f877(int n) {
+    int acc;
+    acc = f876(n) + 877;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f878(int n) {
+    int acc;
+    acc = f877(n) + 878;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f879(int n) {
+    int acc;
+    acc = f878(n) + 879;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f880(int n) {
+    int acc;
+    acc = f879(n) + 880;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f881(int n) {
+    int acc;
+    acc = f880(n) + 881;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f882(int n) {
+    int acc;
+    acc = f881(n) + 882;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f883(int n) {
+    int acc;
+    acc = f882(n) + 883;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f884(int n) {
+    int acc;
+    acc = f883(n) + 884;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f885(int n) {
+    int acc;
+    acc = f884(n) + 885;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f886(int n) {
+    int acc;
+    acc = f885(n) + 886;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f887(int n) {
+    int acc;
+    acc = f886(n) + 887;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f888(int n) {
+    int acc;
+    acc = f887(n) + 888;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f889(int n) {
+    int acc;
+    acc = f888(n) + 889;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f890(int n) {
+    int acc;
+    acc = f889(n) + 890;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f891(int n) {
+    int acc;
+    acc = f890(n) + 891;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f892(int n) {
+    int acc;
+    acc = f891(n) + 892;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f893(int n) {
+    int acc;
+    acc = f892(n) + 893;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f894(int n) {
+    int acc;
+    acc = f893(n) + 894;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f895(int n) {
+    int acc;
+    acc = f894(n) + 895;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f896(int n) {
+    int acc;
+    acc = f895(n) + 896;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f897(int n) {
+    int acc;
+    acc = f896(n) + 897;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f898(int n) {
+    int acc;
+    acc = f897(n) + 898;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f899(int n) {
+    int acc;
+    acc = f898(n) + 899;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f900(int n) {
+    int acc;
+    acc = f899(n) + 900;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f901(int n) {
+    int acc;
+    acc = f900(n) + 901;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f902(int n) {
+    int acc;
+    acc = f901(n) + 902;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f903(int n) {
+    int acc;
+    acc = f902(n) + 903;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f904(int n) {
+    int acc;
+    acc = f903(n) + 904;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f905(int n) {
+    int acc;
+    acc = f904(n) + 905;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f906(int n) {
+    int acc;
+    acc = f905(n) + 906;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f907(int n) {
+    int acc;
+    acc = f906(n) + 907;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f908(int n) {
+    int acc;
+    acc = f907(n) + 908;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f909(int n) {
+    int acc;
+    acc = f908(n) + 909;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f910(int n) {
+    int acc;
+    acc = f909(n) + 910;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f911(int n) {
+    int acc;
+    acc = f910(n) + 911;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f912(int n) {
+    int acc;
+    acc = f911(n) + 912;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f913(int n) {
+    int acc;
+    acc = f912(n) + 913;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f914(int n) {
+    int acc;
+    acc = f913(n) + 914;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f915(int n) {
+    int acc;
+    acc = f914(n) + 915;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f916(int n) {
+    int acc;
+    acc = f915(n) + 916;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f917(int n) {
+    int acc;
+    acc = f916(n) + 917;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f918(int n) {
+    int acc;
+    acc = f917(n) + 918;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f919(int n) {
+    int acc;
+    acc = f918(n) + 919;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f920(int n) {
+    int acc;
+    acc = f919(n) + 920;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f921(int n) {
+    int acc;
+    acc = f920(n) + 921;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f922(int n) {
+    int acc;
+    acc = f921(n) + 922;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f923(int n) {
+    int acc;
+    acc = f922(n) + 923;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f924(int n) {
+    int acc;
+    acc = f923(n) + 924;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f925(int n) {
+    int acc;
+    acc = f924(n) + 925;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f926(int n) {
+    int acc;
+    acc = f925(n) + 926;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f927(int n) {
+    int acc;
+    acc = f926(n) + 927;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f928(int n) {
+    int acc;
+    acc = f927(n) + 928;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f929(int n) {
+    int acc;
+    acc = f928(n) + 929;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f930(int n) {
+    int acc;
+    acc = f929(n) + 930;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f931(int n) {
+    int acc;
+    acc = f930(n) + 931;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f932(int n) {
+    int acc;
+    acc = f931(n) + 932;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f933(int n) {
+    int acc;
+    acc = f932(n) + 933;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f934(int n) {
+    int acc;
+    acc = f933(n) + 934;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f935(int n) {
+    int acc;
+    acc = f934(n) + 935;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f936(int n) {
+    int acc;
+    acc = f935(n) + 936;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f937(int n) {
+    int acc;
+    acc = f936(n) + 937;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f938(int n) {
+    int acc;
+    acc = f937(n) + 938;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f939(int n) {
+    int acc;
+    acc = f938(n) + 939;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f940(int n) {
+    int acc;
+    acc = f939(n) + 940;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f941(int n) {
+    int acc;
+    acc = f940(n) + 941;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f942(int n) {
+    int acc;
+    acc = f941(n) + 942;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f943(int n) {
+    int acc;
+    acc = f942(n) + 943;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f944(int n) {
+    int acc;
+    acc = f943(n) + 944;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f945(int n) {
+    int acc;
+    acc = f944(n) + 945;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f946(int n) {
+    int acc;
+    acc = f945(n) + 946;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f947(int n) {
+    int acc;
+    acc = f946(n) + 947;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f948(int n) {
+    int acc;
+    acc = f947(n) + 948;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f949(int n) {
+    int acc;
+    acc = f948(n) + 949;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f950(int n) {
+    int acc;
+    acc = f949(n) + 950;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f951(int n) {
+    int acc;
+    acc = f950(n) + 951;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f952(int n) {
+    int acc;
+    acc = f951(n) + 952;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f953(int n) {
+    int acc;
+    acc = f952(n) + 953;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f954(int n) {
+    int acc;
+    acc = f953(n) + 954;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f955(int n) {
+    int acc;
+    acc = f954(n) + 955;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f956(int n) {
+    int acc;
+    acc = f955(n) + 956;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f957(int n) {
+    int acc;
+    acc = f956(n) + 957;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f958(int n) {
+    int acc;
+    acc = f957(n) + 958;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f959(int n) {
+    int acc;
+    acc = f958(n) + 959;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f960(int n) {
+    int acc;
+    acc = f959(n) + 960;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f961(int n) {
+    int acc;
+    acc = f960(n) + 961;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f962(int n) {
+    int acc;
+    acc = f961(n) + 962;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f963(int n) {
+    int acc;
+    acc = f962(n) + 963;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f964(int n) {
+    int acc;
+    acc = f963(n) + 964;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f965(int n) {
+    int acc;
+    acc = f964(n) + 965;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f966(int n) {
+    int acc;
+    acc = f965(n) + 966;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f967(int n) {
+    int acc;
+    acc = f966(n) + 967;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f968(int n) {
+    int acc;
+    acc = f967(n) + 968;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f969(int n) {
+    int acc;
+    acc = f968(n) + 969;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f970(int n) {
+    int acc;
+    acc = f969(n) + 970;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f971(int n) {
+    int acc;
+    acc = f970(n) + 971;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f972(int n) {
+    int acc;
+    acc = f971(n) + 972;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f973(int n) {
+    int acc;
+    acc = f972(n) + 973;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f974(int n) {
+    int acc;
+    acc = f973(n) + 974;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f975(int n) {
+    int acc;
+    acc = f974(n) + 975;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f976(int n) {
+    int acc;
+    acc = f975(n) + 976;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f977(int n) {
+    int acc;
+    acc = f976(n) + 977;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f978(int n) {
+    int acc;
+    acc = f977(n) + 978;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f979(int n) {
+    int acc;
+    acc = f978(n) + 979;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f980(int n) {
+    int acc;
+    acc = f979(n) + 980;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f981(int n) {
+    int acc;
+    acc = f980(n) + 981;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f982(int n) {
+    int acc;
+    acc = f981(n) + 982;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f983(int n) {
+    int acc;
+    acc = f982(n) + 983;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f984(int n) {
+    int acc;
+    acc = f983(n) + 984;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f985(int n) {
+    int acc;
+    acc = f984(n) + 985;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f986(int n) {
+    int acc;
+    acc = f985(n) + 986;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f987(int n) {
+    int acc;
+    acc = f986(n) + 987;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f988(int n) {
+    int acc;
+    acc = f987(n) + 988;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f989(int n) {
+    int acc;
+    acc = f988(n) + 989;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f990(int n) {
+    int acc;
+    acc = f989(n) + 990;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f991(int n) {
+    int acc;
+    acc = f990(n) + 991;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f992(int n) {
+    int acc;
+    acc = f991(n) + 992;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f993(int n) {
+    int acc;
+    acc = f992(n) + 993;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f994(int n) {
+    int acc;
+    acc = f993(n) + 994;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f995(int n) {
+    int acc;
+    acc = f994(n) + 995;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f996(int n) {
+    int acc;
+    acc = f995(n) + 996;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f997(int n) {
+    int acc;
+    acc = f996(n) + 997;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f998(int n) {
+    int acc;
+    acc = f997(n) + 998;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f999(int n) {
+    int acc;
+    acc = f998(n) + 999;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1000(int n) {
+    int acc;
+    acc = f999(n) + 1000;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1001(int n) {
+    int acc;
+    acc = f1000(n) + 1001;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1002(int n) {
+    int acc;
+    acc = f1001(n) + 1002;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1003(int n) {
+    int acc;
+    acc = f1002(n) + 1003;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1004(int n) {
+    int acc;
+    acc = f1003(n) + 1004;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1005(int n) {
+    int acc;
+    acc = f1004(n) + 1005;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1006(int n) {
+    int acc;
+    acc = f1005(n) + 1006;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1007(int n) {
+    int acc;
+    acc = f1006(n) + 1007;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1008(int n) {
+    int acc;
+    acc = f1007(n) + 1008;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1009(int n) {
+    int acc;
+    acc = f1008(n) + 1009;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1010(int n) {
+    int acc;
+    acc = f1009(n) + 1010;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1011(int n) {
+    int acc;
+    acc = f1010(n) + 1011;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1012(int n) {
+    int acc;
+    acc = f1011(n) + 1012;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1013(int n) {
+    int acc;
+    acc = f1012(n) + 1013;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1014(int n) {
+    int acc;
+    acc = f1013(n) + 1014;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1015(int n) {
+    int acc;
+    acc = f1014(n) + 1015;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1016(int n) {
+    int acc;
+    acc = f1015(n) + 1016;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1017(int n) {
+    int acc;
+    acc = f1016(n) + 1017;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1018(int n) {
+    int acc;
+    acc = f1017(n) + 1018;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1019(int n) {
+    int acc;
+    acc = f1018(n) + 1019;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1020(int n) {
+    int acc;
+    acc = f1019(n) + 1020;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1021(int n) {
+    int acc;
+    acc = f1020(n) + 1021;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1022(int n) {
+    int acc;
+    acc = f1021(n) + 1022;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int f1023(int n) {
+    int acc;
+    acc = f1022(n) + 1023;
+    if (acc > 1000000) {
+        acc = acc - 1000000;
+    }
+    return acc;
+}
+
+int main() {
+    print(f1023(1));
+    print("\n");
+    return 0;
+}
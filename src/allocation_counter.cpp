@@ -0,0 +1,20 @@
+// Replacement of the global operator new that counts every allocation for
+// ThreadAllocations. Linked only into the compiler executable.
+
+#include <cstdlib>
+#include <new>
+
+#include "stats.h"
+
+void* operator new(std::size_t size) {
+    CountAllocation(size);
+    if (size == 0) size = 1;
+    while (true) {
+        if (void* ptr = std::malloc(size)) return ptr;
+        auto handler = std::get_new_handler();
+        if (!handler) throw std::bad_alloc();
+        handler();
+    }
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
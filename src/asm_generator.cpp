@@ -0,0 +1,705 @@
+#include "asm_generator.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "ast/arithmetic_op.h"
+#include "ast/array.h"
+#include "ast/assign.h"
+#include "ast/bool_literal.h"
+#include "ast/fun_call.h"
+#include "ast/function.h"
+#include "ast/if_then_else.h"
+#include "ast/integer.h"
+#include "ast/logic_op.h"
+#include "ast/print.h"
+#include "ast/program.h"
+#include "ast/rand.h"
+#include "ast/return.h"
+#include "ast/string_literal.h"
+#include "ast/var.h"
+#include "ast/while.h"
+
+namespace {
+
+const char* const kArgRegisters[] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};
+constexpr int kArgRegisterCount = 6;
+
+std::string FunctionLabel(const std::string& name) { return "fn_" + name; }
+
+std::string GlobalLabel(int index) {
+    return ".Lglobal" + std::to_string(index);
+}
+
+std::string Quote(const std::string& value) {
+    std::string result = "\"";
+    for (unsigned char c : value) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+            result += c;
+        } else if (c >= 0x20 && c < 0x7f) {
+            result += c;
+        } else {
+            char buf[5];
+            std::snprintf(buf, sizeof(buf), "\\%03o", c);
+            result += buf;
+        }
+    }
+    return result + "\"";
+}
+
+}  // namespace
+
+void AsmGenerator::Generate() {
+    auto* program = static_cast<AST::Program*>(ir_.GetAST().get());
+
+    Emit(".intel_syntax noprefix");
+    Emit(".text");
+
+    AST::Function* main_func = nullptr;
+    for (auto global : program->globals) {
+        if (global->node_type == AST::NodeType::Function) {
+            auto* func = static_cast<AST::Function*>(global.get());
+            if (func->name == AST::Symbol("main")) main_func = func;
+        } else {
+            GenerateGlobal(global.get());
+        }
+    }
+    if (!main_func) {
+        Error(program, "main function undefined");
+    }
+
+    for (auto global : program->globals) {
+        if (global->node_type == AST::NodeType::Function) {
+            GenerateFunction(static_cast<AST::Function*>(global.get()));
+        }
+    }
+
+    // The exit status is the value returned by an int main.
+    os_ << '\n';
+    Emit(".globl main");
+    Emit(".type main, @function");
+    Label("main");
+    Emit("sub rsp, 8");
+    Emit("call ", FunctionLabel("main"));
+    if (main_func->return_type.base != AST::BaseType::Int) {
+        Emit("xor eax, eax");
+    }
+    Emit("add rsp, 8");
+    Emit("ret");
+
+    if (uses_fail_) {
+        // rdi: dprintf format, esi and edx: its arguments.
+        os_ << '\n';
+        Label(".Lfail");
+        Emit("and rsp, -16");
+        Emit("mov ecx, edx");
+        Emit("mov edx, esi");
+        Emit("mov rsi, rdi");
+        Emit("mov edi, 2");
+        Emit("xor eax, eax");
+        Emit("call dprintf@PLT");
+        Emit("mov edi, 1");
+        Emit("call exit@PLT");
+    }
+
+    os_ << '\n';
+    Emit(".section .rodata");
+    Label(".Lfmt_int");
+    Emit(".string \"%d\"");
+    Label(".Lfmt_str");
+    Emit(".string \"%s\"");
+    os_ << rodata_.str();
+
+    Emit(".section .note.GNU-stack,\"\",@progbits");
+    out_ << os_.str();
+}
+
+void AsmGenerator::GenerateGlobal(AST::ASTNode* node) {
+    AST::Symbol name;
+    int bytes = 4;
+    int index = -1;
+    if (node->node_type == AST::NodeType::ArrayDeclaration) {
+        auto* decl = static_cast<AST::ArrayDeclaration*>(node);
+        if (decl->type.array_size <= 0) {
+            Error(node, "array '", decl->name, "' has no size");
+        }
+        name = decl->name;
+        index = decl->ref.index;
+        bytes = 4 * decl->type.array_size;
+        global_arrays_[index] = decl->type.array_size;
+    } else if (node->node_type == AST::NodeType::VarDef) {
+        auto* def = static_cast<AST::VarDef*>(node);
+        if (def->type.is_array) {
+            Error(node, "array '", def->name, "' has no size");
+        }
+        // Zero with the uninitialized marker set.
+        Emit(".data");
+        Emit(".align 8");
+        os_ << GlobalLabel(def->ref.index) << ":\t# " << def->name << '\n';
+        Emit(".long 0, 1");
+        Emit(".text");
+        return;
+    } else {
+        Error(node, "unexpected global");
+    }
+
+    Emit(".bss");
+    Emit(".align 16");
+    os_ << GlobalLabel(index) << ":\t# " << name << '\n';
+    Emit(".zero ", bytes);
+    Emit(".text");
+}
+
+void AsmGenerator::AllocateArrays(const AST::Statements& stmts,
+                                  int* frame_bytes) {
+    for (auto stmt : stmts) {
+        switch (stmt->node_type) {
+            case AST::NodeType::ArrayDeclaration: {
+                auto* decl = static_cast<AST::ArrayDeclaration*>(stmt.get());
+                if (decl->type.array_size <= 0) {
+                    Error(decl, "array '", decl->name, "' has no size");
+                }
+                *frame_bytes += (4 * decl->type.array_size + 7) / 8 * 8;
+                array_storage_[decl] = *frame_bytes;
+                break;
+            }
+            case AST::NodeType::IfThenElse: {
+                auto* node = static_cast<AST::IfThenElse*>(stmt.get());
+                AllocateArrays(node->then_branch, frame_bytes);
+                AllocateArrays(node->else_branch, frame_bytes);
+                break;
+            }
+            case AST::NodeType::While:
+                AllocateArrays(static_cast<AST::While*>(stmt.get())->body,
+                               frame_bytes);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void AsmGenerator::GenerateFunction(AST::Function* node) {
+    if (node->return_type.is_array) {
+        Error(node, "returning arrays is not supported by the native backend");
+    }
+
+    return_label_ = NewLabel();
+    depth_ = 0;
+    local_arrays_.clear();
+    array_storage_.clear();
+    initialized_.assign(node->frame_size, false);
+
+    int frame_bytes = 8 * node->frame_size;
+    AllocateArrays(node->body, &frame_bytes);
+    frame_bytes = (frame_bytes + 15) / 16 * 16;
+
+    os_ << '\n';
+    Emit(".type ", FunctionLabel(node->name.Str()), ", @function");
+    Label(FunctionLabel(node->name.Str()));
+    Emit("push rbp");
+    Emit("mov rbp, rsp");
+    if (frame_bytes > 0) Emit("sub rsp, ", frame_bytes);
+
+    for (size_t i = 0; i < node->args.size(); ++i) {
+        AST::VarRef ref{AST::VarRef::Scope::Local, static_cast<int>(i)};
+        SetInitialized(ref, true);
+        if (node->args[i].type.is_array) {
+            local_arrays_[i] = node->args[i].type.array_size;
+        }
+        if (i < kArgRegisterCount) {
+            Emit("mov ", Slot(ref, "qword"), ", ", kArgRegisters[i]);
+        } else {
+            Emit("mov rax, qword ptr [rbp + ", 16 + 8 * (i - kArgRegisterCount),
+                 "]");
+            Emit("mov ", Slot(ref, "qword"), ", rax");
+        }
+    }
+
+    GenerateBlock(node->body);
+
+    Label(return_label_);
+    Emit("leave");
+    Emit("ret");
+    os_ << stubs_.str();
+    stubs_.str("");
+}
+
+void AsmGenerator::GenerateBlock(const AST::Statements& stmts) {
+    for (auto stmt : stmts) {
+        GenerateStmt(stmt.get());
+    }
+}
+
+void AsmGenerator::GenerateStmt(AST::ASTNode* node) {
+    switch (node->node_type) {
+        case AST::NodeType::ArrayAssignment:
+            GenerateStmt(static_cast<AST::ArrayAssignment*>(node));
+            break;
+        case AST::NodeType::ArrayDeclaration:
+            GenerateStmt(static_cast<AST::ArrayDeclaration*>(node));
+            break;
+        case AST::NodeType::Assign:
+            GenerateStmt(static_cast<AST::Assign*>(node));
+            break;
+        case AST::NodeType::IfThenElse:
+            GenerateStmt(static_cast<AST::IfThenElse*>(node));
+            break;
+        case AST::NodeType::Print:
+            GenerateStmt(static_cast<AST::Print*>(node));
+            break;
+        case AST::NodeType::Return:
+            GenerateStmt(static_cast<AST::Return*>(node));
+            break;
+        case AST::NodeType::VarDef: {
+            // Every execution of the declaration uninitializes the slot.
+            auto* def = static_cast<AST::VarDef*>(node);
+            if (def->type.is_array) {
+                Error(node, "array '", def->name, "' has no size");
+            }
+            auto& ref = def->ref;
+            Emit("mov ", MarkerSlot(ref), ", 1");
+            SetInitialized(ref, false);
+            break;
+        }
+        case AST::NodeType::While:
+            GenerateStmt(static_cast<AST::While*>(node));
+            break;
+        case AST::NodeType::Function:
+            Error(node, "a function-definition is not allowed here");
+            break;
+        default:
+            GenerateExpr(node);
+    }
+}
+
+void AsmGenerator::GenerateStmt(AST::ArrayAssignment* node) {
+    GenerateExpr(node->index.get());
+    if (node->check_bounds) {
+        GenerateBoundsCheck(node, node->index.get(), node->ref);
+    }
+
+    auto value = Operand(node->expr.get());
+    if (!value.empty()) {
+        if (!IsImmediate(node->expr.get())) {
+            Emit("mov edx, ", value);
+            value = "edx";
+        }
+        GenerateArrayBase(node->ref, "rcx");
+        Emit("mov dword ptr [rcx + rax * 4], ", value);
+        return;
+    }
+
+    Push("rax");
+    GenerateExpr(node->expr.get());
+    Pop("rdx");
+    GenerateArrayBase(node->ref, "rcx");
+    Emit("mov dword ptr [rcx + rdx * 4], eax");
+}
+
+void AsmGenerator::GenerateStmt(AST::ArrayDeclaration* node) {
+    local_arrays_[node->ref.index] = node->type.array_size;
+
+    // Every execution of the declaration starts from a zeroed array.
+    Emit("lea rdi, [rbp - ", array_storage_.at(node), "]");
+    Emit("mov ", Slot(node->ref, "qword"), ", rdi");
+    Emit("xor eax, eax");
+    Emit("mov ecx, ", node->type.array_size);
+    Emit("rep stosd");
+}
+
+void AsmGenerator::GenerateStmt(AST::Assign* node) {
+    // Local arrays live in the frame and are zeroed again by every
+    // execution of their declaration, so an alias to one could neither
+    // outlive the call nor keep the contents the other backends keep.
+    if (node->expr->type.is_array) {
+        Error(node, "assigning arrays is not supported by the native backend");
+    }
+    if (IsImmediate(node->expr.get())) {
+        Emit("mov ", Slot(node->ref), ", ", Operand(node->expr.get()));
+    } else {
+        GenerateExpr(node->expr.get());
+        Emit("mov ", Slot(node->ref), ", eax");
+    }
+    if (!IsInitialized(node->ref)) Emit("mov ", MarkerSlot(node->ref), ", 0");
+    SetInitialized(node->ref, true);
+}
+
+void AsmGenerator::GenerateStmt(AST::IfThenElse* node) {
+    auto else_label = NewLabel();
+    GenerateBranch(node->condition.get(), else_label, false);
+    auto before = initialized_;
+    GenerateBlock(node->then_branch);
+    auto after_then = initialized_;
+    initialized_ = before;
+    if (node->else_branch.empty()) {
+        Label(else_label);
+    } else {
+        auto end_label = NewLabel();
+        Emit("jmp ", end_label);
+        Label(else_label);
+        GenerateBlock(node->else_branch);
+        Label(end_label);
+    }
+    for (size_t i = 0; i < initialized_.size(); ++i) {
+        initialized_[i] = initialized_[i] && after_then[i];
+    }
+}
+
+void AsmGenerator::GenerateStmt(AST::Print* node) {
+    if (node->expr->node_type == AST::NodeType::StringLiteral) {
+        auto* str = static_cast<AST::StringLiteral*>(node->expr.get());
+        Emit("lea rsi, [rip + ", StringLabel(str->value), "]");
+        Emit("lea rdi, [rip + .Lfmt_str]");
+    } else {
+        GenerateExpr(node->expr.get());
+        Emit("mov esi, eax");
+        Emit("lea rdi, [rip + .Lfmt_int]");
+    }
+    Emit("xor eax, eax");
+    CallExternal("printf");
+}
+
+void AsmGenerator::GenerateStmt(AST::Return* node) {
+    if (node->expr) GenerateExpr(node->expr.get());
+    Emit("jmp ", return_label_);
+}
+
+void AsmGenerator::GenerateStmt(AST::While* node) {
+    // The condition is tested at the bottom so each iteration takes a
+    // single branch.
+    auto body_label = NewLabel();
+    auto cond_label = NewLabel();
+    Emit("jmp ", cond_label);
+    Label(body_label);
+    // The body may not run, and the condition first runs before it.
+    auto before = initialized_;
+    GenerateBlock(node->body);
+    initialized_ = before;
+    Label(cond_label);
+    GenerateBranch(node->condition.get(), body_label, true);
+}
+
+void AsmGenerator::GenerateExpr(AST::ASTNode* node) {
+    switch (node->node_type) {
+        case AST::NodeType::ArithOp:
+            GenerateExpr(static_cast<AST::ArithOp*>(node));
+            break;
+        case AST::NodeType::ArrayAccess:
+            GenerateExpr(static_cast<AST::ArrayAccess*>(node));
+            break;
+        case AST::NodeType::BoolLiteral:
+            Emit("mov eax, ", static_cast<AST::BoolLiteral*>(node)->value);
+            break;
+        case AST::NodeType::FunCall:
+            GenerateExpr(static_cast<AST::FunCall*>(node));
+            break;
+        case AST::NodeType::Integer:
+            Emit("mov eax, ", static_cast<AST::Integer*>(node)->value);
+            break;
+        case AST::NodeType::LogicOp:
+            GenerateExpr(static_cast<AST::LogicOp*>(node));
+            break;
+        case AST::NodeType::Rand:
+            CallExternal("rand");
+            break;
+        case AST::NodeType::StringLiteral:
+            Error(node, "strings can only be printed by the native backend");
+            break;
+        case AST::NodeType::Var:
+            GenerateExpr(static_cast<AST::Var*>(node));
+            break;
+        default:
+            Error(node, "unknown node");
+    }
+}
+
+void AsmGenerator::GenerateExpr(AST::ArithOp* node) {
+    GenerateExpr(node->lhs.get());
+
+    auto rhs = Operand(node->rhs.get());
+    bool is_div =
+        node->op == AST::Operator::Div || node->op == AST::Operator::Mod;
+    if (rhs.empty() || is_div) {
+        if (rhs.empty()) {
+            Push("rax");
+            GenerateExpr(node->rhs.get());
+            Emit("mov ecx, eax");
+            Pop("rax");
+        } else {
+            Emit("mov ecx, ", rhs);
+        }
+        rhs = "ecx";
+    }
+
+    if (node->op == AST::Operator::Add) {
+        Emit("add eax, ", rhs);
+    } else if (node->op == AST::Operator::Sub) {
+        Emit("sub eax, ", rhs);
+    } else if (node->op == AST::Operator::Mul) {
+        if (IsImmediate(node->rhs.get())) {
+            Emit("imul eax, eax, ", rhs);
+        } else {
+            Emit("imul eax, ", rhs);
+        }
+    } else if (is_div) {
+        bool nonzero_literal =
+            node->rhs->node_type == AST::NodeType::Integer &&
+            static_cast<AST::Integer*>(node->rhs.get())->value != 0;
+        if (!nonzero_literal) {
+            Emit("test ecx, ecx");
+            Emit("je ", FailLabel(node, "division by zero"));
+        }
+        Emit("cdq");
+        Emit("idiv ecx");
+        if (node->op == AST::Operator::Mod) Emit("mov eax, edx");
+    } else {
+        Error(node, "Unknown arith op: ", node->op);
+    }
+}
+
+void AsmGenerator::GenerateExpr(AST::ArrayAccess* node) {
+    GenerateExpr(node->index.get());
+    if (node->check_bounds) {
+        GenerateBoundsCheck(node, node->index.get(), node->ref);
+    }
+    GenerateArrayBase(node->ref, "rcx");
+    Emit("mov eax, dword ptr [rcx + rax * 4]");
+}
+
+void AsmGenerator::GenerateExpr(AST::FunCall* node) {
+    // Arguments are evaluated left to right into an outgoing area: stack
+    // arguments at the bottom, register arguments above them.
+    int count = node->args.size();
+    int stack_args = std::max(0, count - kArgRegisterCount);
+    int words = count + (depth_ + count) % 2;
+    if (words > 0) {
+        Emit("sub rsp, ", 8 * words);
+        depth_ += words;
+    }
+
+    for (int i = 0; i < count; ++i) {
+        GenerateExpr(node->args[i].get());
+        int offset = i < kArgRegisterCount ? 8 * (stack_args + i)
+                                           : 8 * (i - kArgRegisterCount);
+        Emit("mov qword ptr [rsp + ", offset, "], rax");
+    }
+    for (int i = 0; i < std::min(count, kArgRegisterCount); ++i) {
+        Emit("mov ", kArgRegisters[i], ", qword ptr [rsp + ",
+             8 * (stack_args + i), "]");
+    }
+
+    Emit("call ", FunctionLabel(node->name.Str()));
+    if (words > 0) {
+        Emit("add rsp, ", 8 * words);
+        depth_ -= words;
+    }
+}
+
+void AsmGenerator::GenerateExpr(AST::LogicOp* node) {
+    GenerateCompare(node->lhs.get(), node->rhs.get());
+    if (node->op == AST::Operator::Less) {
+        Emit("setl al");
+    } else if (node->op == AST::Operator::Greater) {
+        Emit("setg al");
+    } else if (node->op == AST::Operator::Equal) {
+        Emit("sete al");
+    } else {
+        Error(node, "Unknown logic op: ", node->op);
+    }
+    Emit("movzx eax, al");
+}
+
+void AsmGenerator::GenerateExpr(AST::Var* node) {
+    if (!node->type.is_array) {
+        GenerateInitCheck(node);
+        Emit("mov eax, ", Slot(node->ref));
+    } else if (node->ref.IsGlobal()) {
+        Emit("lea rax, [rip + ", GlobalLabel(node->ref.index), "]");
+    } else {
+        Emit("mov rax, ", Slot(node->ref, "qword"));
+    }
+}
+
+void AsmGenerator::GenerateBranch(AST::ASTNode* cond, const std::string& label,
+                                  bool jump_if) {
+    if (cond->node_type == AST::NodeType::BoolLiteral) {
+        if (static_cast<AST::BoolLiteral*>(cond)->value == jump_if) {
+            Emit("jmp ", label);
+        }
+        return;
+    }
+
+    if (cond->node_type == AST::NodeType::LogicOp) {
+        auto* node = static_cast<AST::LogicOp*>(cond);
+        GenerateCompare(node->lhs.get(), node->rhs.get());
+        if (node->op == AST::Operator::Less) {
+            Emit(jump_if ? "jl " : "jge ", label);
+        } else if (node->op == AST::Operator::Greater) {
+            Emit(jump_if ? "jg " : "jle ", label);
+        } else if (node->op == AST::Operator::Equal) {
+            Emit(jump_if ? "je " : "jne ", label);
+        } else {
+            Error(node, "Unknown logic op: ", node->op);
+        }
+        return;
+    }
+
+    GenerateExpr(cond);
+    Emit("test eax, eax");
+    Emit(jump_if ? "jne " : "je ", label);
+}
+
+void AsmGenerator::GenerateCompare(AST::ASTNode* lhs, AST::ASTNode* rhs) {
+    GenerateExpr(lhs);
+    auto operand = Operand(rhs);
+    if (operand.empty()) {
+        Push("rax");
+        GenerateExpr(rhs);
+        Emit("mov ecx, eax");
+        Pop("rax");
+        operand = "ecx";
+    }
+    Emit("cmp eax, ", operand);
+}
+
+void AsmGenerator::GenerateBoundsCheck(AST::ASTNode* node, AST::ASTNode* index,
+                                       const AST::VarRef& ref) {
+    int size = ArraySize(ref);
+    auto label = [&] {
+        return FailLabel(node, "array access %d out of bounds %d", size);
+    };
+    // Literal indices, including ones produced by constant folding, are
+    // checked here; only out of bounds ones need code.
+    if (index->node_type == AST::NodeType::Integer) {
+        auto value = static_cast<AST::Integer*>(index)->value;
+        if (value < 0 || value >= size) Emit("jmp ", label());
+        return;
+    }
+
+    Emit("cmp eax, ", size);
+    Emit("jae ", label());
+}
+
+void AsmGenerator::GenerateArrayBase(const AST::VarRef& ref, const char* reg) {
+    if (ref.IsGlobal()) {
+        Emit("lea ", reg, ", [rip + ", GlobalLabel(ref.index), "]");
+    } else {
+        Emit("mov ", reg, ", ", Slot(ref, "qword"));
+    }
+}
+
+std::string AsmGenerator::Slot(const AST::VarRef& ref,
+                               const char* width) const {
+    std::string prefix = std::string(width) + " ptr ";
+    if (ref.IsGlobal()) {
+        return prefix + "[rip + " + GlobalLabel(ref.index) + "]";
+    }
+    return prefix + "[rbp - " + std::to_string(8 * (ref.index + 1)) + "]";
+}
+
+std::string AsmGenerator::MarkerSlot(const AST::VarRef& ref) const {
+    if (ref.IsGlobal()) {
+        return "dword ptr [rip + " + GlobalLabel(ref.index) + " + 4]";
+    }
+    return "dword ptr [rbp - " + std::to_string(8 * ref.index + 4) + "]";
+}
+
+void AsmGenerator::GenerateInitCheck(AST::Var* node) {
+    if (IsInitialized(node->ref)) return;
+    Emit("cmp ", MarkerSlot(node->ref), ", 0");
+    Emit("jne ",
+         FailLabel(node, "Variable " + node->name.Str() + " uninitialized"));
+}
+
+bool AsmGenerator::IsImmediate(AST::ASTNode* node) const {
+    return node->node_type == AST::NodeType::Integer ||
+           node->node_type == AST::NodeType::BoolLiteral;
+}
+
+std::string AsmGenerator::Operand(AST::ASTNode* node) {
+    switch (node->node_type) {
+        case AST::NodeType::Integer:
+            return std::to_string(static_cast<AST::Integer*>(node)->value);
+        case AST::NodeType::BoolLiteral:
+            return std::to_string(static_cast<AST::BoolLiteral*>(node)->value);
+        case AST::NodeType::Var: {
+            auto* var = static_cast<AST::Var*>(node);
+            if (var->type.is_array) return {};
+            GenerateInitCheck(var);
+            return Slot(var->ref);
+        }
+        default:
+            return {};
+    }
+}
+
+int AsmGenerator::ArraySize(const AST::VarRef& ref) const {
+    const auto& arrays = ref.IsGlobal() ? global_arrays_ : local_arrays_;
+    return arrays.at(ref.index);
+}
+
+bool AsmGenerator::IsInitialized(const AST::VarRef& ref) const {
+    // Globals may be read by any function before main assigns them.
+    return !ref.IsGlobal() &&
+           ref.index < static_cast<int>(initialized_.size()) &&
+           initialized_[ref.index];
+}
+
+void AsmGenerator::SetInitialized(const AST::VarRef& ref, bool value) {
+    if (ref.IsGlobal()) return;
+    if (ref.index >= static_cast<int>(initialized_.size())) {
+        initialized_.resize(ref.index + 1, false);
+    }
+    initialized_[ref.index] = value;
+}
+
+void AsmGenerator::Push(const char* reg) {
+    Emit("push ", reg);
+    ++depth_;
+}
+
+void AsmGenerator::Pop(const char* reg) {
+    Emit("pop ", reg);
+    --depth_;
+}
+
+void AsmGenerator::CallExternal(const std::string& name) {
+    bool misaligned = depth_ % 2 != 0;
+    if (misaligned) Emit("sub rsp, 8");
+    Emit("call ", name, "@PLT");
+    if (misaligned) Emit("add rsp, 8");
+}
+
+std::string AsmGenerator::NewLabel() {
+    return ".L" + std::to_string(next_label_++);
+}
+
+std::string AsmGenerator::StringLabel(const std::string& value) {
+    auto iter = strings_.find(value);
+    if (iter != strings_.end()) return iter->second;
+
+    auto label = ".Lstr" + std::to_string(strings_.size());
+    rodata_ << label << ":\n\t.string " << Quote(value) << '\n';
+    strings_.emplace(value, label);
+    return label;
+}
+
+std::string AsmGenerator::FailLabel(AST::ASTNode* node,
+                                    const std::string& message,
+                                    int array_size) {
+    uses_fail_ = true;
+
+    std::ostringstream text;
+    text << node->loc << ": " << message << '\n';
+    auto label = NewLabel();
+    stubs_ << label << ":\n";
+    if (array_size >= 0) {
+        stubs_ << "\tmov esi, eax\n";
+        stubs_ << "\tmov edx, " << array_size << '\n';
+    }
+    stubs_ << "\tlea rdi, [rip + " << StringLabel(text.str()) << "]\n";
+    stubs_ << "\tjmp .Lfail\n";
+    return label;
+}
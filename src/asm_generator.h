@@ -0,0 +1,137 @@
+#pragma once
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ast/ast.h"
+#include "ast/var_ref.h"
+#include "ir.h"
+
+// Emits x86-64 System V assembly (GNU as, Intel syntax) for the checked IR.
+// The result is linked against libc with the system toolchain:
+//
+//     compiler --emit=asm -o fire.s fire.c && cc -o fire fire.s
+//
+// Every variable lives in an 8-byte stack slot or in the data sections.
+// Ints and bools are kept in the low 32 bits, and a non-zero upper half
+// marks them as uninitialized until assigned. Arrays are pointers to
+// zero-initialized storage of their declared size, passed to calls by
+// pointer; array variables declared without a size, and assigning and
+// returning whole arrays, are not supported.
+// Expressions are evaluated into eax/rax with intermediate values pushed
+// on the machine stack.
+class AsmGenerator {
+   public:
+    AsmGenerator(const IR& ir, std::ostream& out) : ir_(ir), out_(out) {}
+
+    // Writes the whole program to out, or nothing if it throws.
+    void Generate();
+
+   private:
+    void GenerateGlobal(AST::ASTNode* node);
+    void GenerateFunction(AST::Function* node);
+    // Assigns frame storage below the slots to every local array declared
+    // in stmts, advancing frame_bytes.
+    void AllocateArrays(const AST::Statements& stmts, int* frame_bytes);
+
+    void GenerateStmt(AST::ASTNode* node);
+    void GenerateStmt(AST::ArrayAssignment* node);
+    void GenerateStmt(AST::ArrayDeclaration* node);
+    void GenerateStmt(AST::Assign* node);
+    void GenerateStmt(AST::IfThenElse* node);
+    void GenerateStmt(AST::Print* node);
+    void GenerateStmt(AST::Return* node);
+    void GenerateStmt(AST::While* node);
+    void GenerateBlock(const AST::Statements& stmts);
+
+    // Evaluates an expression into eax, or rax for array values.
+    void GenerateExpr(AST::ASTNode* node);
+    void GenerateExpr(AST::ArithOp* node);
+    void GenerateExpr(AST::ArrayAccess* node);
+    void GenerateExpr(AST::FunCall* node);
+    void GenerateExpr(AST::LogicOp* node);
+    void GenerateExpr(AST::Var* node);
+
+    // Jumps to label when the condition evaluates to jump_if.
+    void GenerateBranch(AST::ASTNode* cond, const std::string& label,
+                        bool jump_if);
+    // Compares lhs with rhs, leaving the flags set.
+    void GenerateCompare(AST::ASTNode* lhs, AST::ASTNode* rhs);
+    // Bounds-checks the index held in eax against the declared size.
+    void GenerateBoundsCheck(AST::ASTNode* node, AST::ASTNode* index,
+                             const AST::VarRef& ref);
+    // Loads the address of the first array element into reg.
+    void GenerateArrayBase(const AST::VarRef& ref, const char* reg);
+
+    // Memory operand of a variable slot; width is "dword" for scalars and
+    // "qword" for array pointers.
+    std::string Slot(const AST::VarRef& ref, const char* width = "dword") const;
+    // Upper half of a scalar slot, the uninitialized marker.
+    std::string MarkerSlot(const AST::VarRef& ref) const;
+    // Immediate or memory operand for literals and scalar variables, empty
+    // for anything that needs code to evaluate. Variables that may be
+    // uninitialized are checked first.
+    std::string Operand(AST::ASTNode* node);
+    // Fails like the interpreter when the variable is uninitialized,
+    // unless every path to node assigns it.
+    void GenerateInitCheck(AST::Var* node);
+    bool IsImmediate(AST::ASTNode* node) const;
+    int ArraySize(const AST::VarRef& ref) const;
+
+    bool IsInitialized(const AST::VarRef& ref) const;
+    void SetInitialized(const AST::VarRef& ref, bool value);
+
+    void Push(const char* reg);
+    void Pop(const char* reg);
+    // Calls a libc function keeping rsp 16-byte aligned.
+    void CallExternal(const std::string& name);
+
+    std::string NewLabel();
+    std::string StringLabel(const std::string& value);
+    // Returns the label of a cold stub reporting a runtime error at node.
+    std::string FailLabel(AST::ASTNode* node, const std::string& message,
+                          int array_size = -1);
+
+    template <typename... Args>
+    void Emit(Args... args) {
+        os_ << '\t';
+        (os_ << ... << args);
+        os_ << '\n';
+    }
+
+    void Label(const std::string& label) { os_ << label << ":\n"; }
+
+    template <typename... Args>
+    void Error(AST::ASTNode* node, Args... args) {
+        std::ostringstream oss;
+        oss << node->loc;
+        oss << ": ";
+        (oss << ... << args);
+        throw std::runtime_error(oss.str());
+    }
+
+    const IR& ir_;
+    std::ostream& out_;
+    std::ostringstream os_;
+
+    std::string return_label_;
+    // 8-byte words pushed below the fixed part of the current frame.
+    int depth_ = 0;
+    int next_label_ = 0;
+
+    // Declared sizes of arrays by slot, and the frame offsets of the local
+    // array storage of the current function.
+    std::unordered_map<int, int> global_arrays_;
+    std::unordered_map<int, int> local_arrays_;
+    std::unordered_map<AST::ArrayDeclaration*, int> array_storage_;
+    // Local slots assigned on every path to the code being generated.
+    std::vector<bool> initialized_;
+
+    std::unordered_map<std::string, std::string> strings_;
+    std::ostringstream rodata_;
+    std::ostringstream stubs_;
+    bool uses_fail_ = false;
+};
@@ -1,9 +1,8 @@
 ﻿#pragma once
 
-#include <string>
-
 #include "../i_visitor.h"
 #include "expr.h"
+#include "operator.h"
 
 namespace AST {
 
@@ -12,7 +11,7 @@ struct ArithOp : Expr {
 
     void accept(IASTVisitor* visitor) override { visitor->visit(this); }
 
-    std::string op;
+    Operator op;
     std::shared_ptr<Expr> lhs;
     std::shared_ptr<Expr> rhs;
 };
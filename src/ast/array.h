@@ -5,7 +5,10 @@
 #include "../i_visitor.h"
 #include "ast.h"
 #include "expr.h"
+#include "symbol.h"
 #include "type.h"
+#include "var_ref.h"
+
 namespace AST {
 
 struct ArrayDeclaration : public ASTNode {
@@ -13,8 +16,9 @@ struct ArrayDeclaration : public ASTNode {
 
     void accept(IASTVisitor* visitor) override { visitor->visit(this); }
 
-    std::string name;
+    Symbol name;
     Type type;
+    VarRef ref;
 };
 
 struct ArrayAccess : public Expr {
@@ -22,8 +26,11 @@ struct ArrayAccess : public Expr {
 
     void accept(IASTVisitor* visitor) override { visitor->visit(this); }
 
-    std::string name;
+    Symbol name;
+    VarRef ref;
     std::shared_ptr<ASTNode> index;
+    // Cleared when the index is proven to be within the array.
+    bool check_bounds = true;
 };
 
 struct ArrayAssignment : public ASTNode {
@@ -31,9 +38,12 @@ struct ArrayAssignment : public ASTNode {
 
     void accept(IASTVisitor* visitor) override { visitor->visit(this); }
 
-    std::string name;
+    Symbol name;
+    VarRef ref;
     std::shared_ptr<ASTNode> index;
     std::shared_ptr<Expr> expr;
+    // Cleared when the index is proven to be within the array.
+    bool check_bounds = true;
 };
 
 }  // namespace AST
@@ -6,6 +6,8 @@
 #include "../i_visitor.h"
 #include "ast.h"
 #include "expr.h"
+#include "symbol.h"
+#include "var_ref.h"
 
 namespace AST {
 
@@ -14,7 +16,8 @@ struct Assign : public ASTNode {
 
     void accept(IASTVisitor* visitor) override { visitor->visit(this); }
 
-    std::string var;
+    Symbol var;
+    VarRef ref;
     std::shared_ptr<Expr> expr;
 };
 
@@ -5,16 +5,21 @@
 
 #include "../i_visitor.h"
 #include "expr.h"
+#include "symbol.h"
 
 namespace AST {
 
+struct Function;
+
 struct FunCall : public Expr {
     FunCall() : Expr(NodeType::FunCall) {}
 
     void accept(IASTVisitor* visitor) override { visitor->visit(this); }
 
-    std::string name;
+    Symbol name;
     std::vector<std::shared_ptr<AST::Expr>> args;
+    // Callee, resolved by semantic analysis.
+    Function* target = nullptr;
 };
 
 }  // namespace AST
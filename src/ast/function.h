@@ -7,6 +7,7 @@
 #include "../i_visitor.h"
 #include "ast.h"
 #include "name_type.h"
+#include "symbol.h"
 #include "type.h"
 
 namespace AST {
@@ -16,10 +17,12 @@ struct Function : public ASTNode {
 
     void accept(IASTVisitor* visitor) override { visitor->visit(this); }
 
-    std::string name;
+    Symbol name;
     std::vector<NameType> args;
     Statements body;
     Type return_type;
+    // Number of local slots, parameters included; set by semantic analysis.
+    int frame_size = 0;
 };
 
 }  // namespace AST
@@ -1,10 +1,9 @@
 ﻿#pragma once
 
-#include <string>
-
 #include "../i_visitor.h"
 #include "ast.h"
 #include "expr.h"
+#include "operator.h"
 #include "type.h"
 
 namespace AST {
@@ -14,7 +13,7 @@ struct LogicOp : public Expr {
 
     void accept(IASTVisitor* visitor) override { visitor->visit(this); }
 
-    std::string op;
+    Operator op;
     std::shared_ptr<Expr> lhs;
     std::shared_ptr<Expr> rhs;
 };
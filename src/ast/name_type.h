@@ -3,12 +3,13 @@
 #include <string>
 #include <vector>
 
+#include "symbol.h"
 #include "type.h"
 
 namespace AST {
 
 struct NameType {
-    std::string name;
+    Symbol name;
     Type type;
 };
 
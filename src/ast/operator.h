@@ -0,0 +1,36 @@
+﻿#pragma once
+
+#include <iostream>
+
+namespace AST {
+
+// Binary operators of ArithOp (Add..Mod) and LogicOp (Less..Equal).
+enum class Operator { Add, Sub, Mul, Div, Mod, Less, Greater, Equal };
+
+inline const char* ToString(Operator op) {
+    switch (op) {
+        case Operator::Add:
+            return "+";
+        case Operator::Sub:
+            return "-";
+        case Operator::Mul:
+            return "*";
+        case Operator::Div:
+            return "/";
+        case Operator::Mod:
+            return "%";
+        case Operator::Less:
+            return "<";
+        case Operator::Greater:
+            return ">";
+        case Operator::Equal:
+            return "==";
+    }
+    return "?";
+}
+
+inline std::ostream& operator<<(std::ostream& os, Operator op) {
+    return os << ToString(op);
+}
+
+}  // namespace AST
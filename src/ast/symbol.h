@@ -0,0 +1,86 @@
+﻿#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace AST {
+
+// Process-wide table giving every distinct identifier a stable index.
+// Names are stored once and never move, so the text of an interned name
+// stays valid for the life of the process. Guarded by a mutex so that
+// compilations on several threads may share it.
+class Interner {
+   public:
+    static Interner& Global() {
+        static Interner interner;
+        return interner;
+    }
+
+    uint32_t Intern(std::string_view name) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (auto iter = ids_.find(name); iter != ids_.end()) {
+            return iter->second;
+        }
+        uint32_t id = names_.size();
+        const auto& stored = names_.emplace_back(name);
+        ids_.emplace(stored, id);
+        return id;
+    }
+
+    const std::string& Name(uint32_t id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return names_[id];
+    }
+
+    // Number of interned names, the empty name included.
+    size_t Size() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return names_.size();
+    }
+
+   private:
+    Interner() { Intern(""); }
+
+    std::mutex mutex_;
+    std::unordered_map<std::string_view, uint32_t> ids_;
+    std::deque<std::string> names_;
+};
+
+// Interned identifier. Symbols compare and hash as integers; the text is
+// only looked up to print a name.
+class Symbol {
+   public:
+    Symbol() = default;
+    explicit Symbol(std::string_view name)
+        : id_(Interner::Global().Intern(name)) {}
+
+    uint32_t Id() const { return id_; }
+    const std::string& Str() const { return Interner::Global().Name(id_); }
+
+    bool operator==(Symbol other) const { return id_ == other.id_; }
+    bool operator!=(Symbol other) const { return id_ != other.id_; }
+
+    friend bool operator==(Symbol symbol, std::string_view name) {
+        return symbol.Str() == name;
+    }
+
+   private:
+    uint32_t id_ = 0;
+};
+
+inline std::ostream& operator<<(std::ostream& os, Symbol symbol) {
+    return os << symbol.Str();
+}
+
+}  // namespace AST
+
+template <>
+struct std::hash<AST::Symbol> {
+    size_t operator()(AST::Symbol symbol) const { return symbol.Id(); }
+};
@@ -5,7 +5,9 @@
 #include "../i_visitor.h"
 #include "ast.h"
 #include "expr.h"
+#include "symbol.h"
 #include "type.h"
+#include "var_ref.h"
 
 namespace AST {
 
@@ -14,7 +16,8 @@ struct Var : public Expr {
 
     void accept(IASTVisitor* visitor) override { visitor->visit(this); }
 
-    std::string name;
+    Symbol name;
+    VarRef ref;
 };
 
 struct VarDef : public Expr {
@@ -22,8 +25,9 @@ struct VarDef : public Expr {
 
     void accept(IASTVisitor* visitor) override { visitor->visit(this); }
 
-    std::string name;
+    Symbol name;
     Type type;
+    VarRef ref;
 };
 
 }  // namespace AST
@@ -0,0 +1,16 @@
+#pragma once
+
+namespace AST {
+
+// Storage of a variable as resolved by semantic analysis: an index into the
+// globals table or an offset in the frame of the enclosing function.
+struct VarRef {
+    enum class Scope { Unresolved, Global, Local };
+
+    Scope scope = Scope::Unresolved;
+    int index = -1;
+
+    bool IsGlobal() const { return scope == Scope::Global; }
+};
+
+}  // namespace AST
@@ -0,0 +1,41 @@
+#include "backend.h"
+
+#include "interpreter.h"
+#include "vm.h"
+
+std::optional<Backend> ParseBackend(std::string_view name) {
+    if (name == "ast") return Backend::TreeWalker;
+    if (name == "bytecode") return Backend::Bytecode;
+    if (name == "jit") return Backend::Jit;
+    return std::nullopt;
+}
+
+int Execute(Backend backend, const IR& ir, OutputBuffer& out,
+            SamplingProfiler* profiler, std::optional<uint64_t> seed) {
+    switch (backend) {
+        case Backend::Bytecode: {
+            VM vm(ir, out);
+            if (seed) vm.SetSeed(*seed);
+            return vm.Exec();
+        }
+        case Backend::Jit: {
+            Interpreter interpreter(ir, out);
+            interpreter.SetProfiler(profiler);
+            if (seed) interpreter.SetSeed(*seed);
+            interpreter.EnableJit();
+            return interpreter.Exec();
+        }
+        case Backend::TreeWalker:
+        default: {
+            Interpreter interpreter(ir, out);
+            interpreter.SetProfiler(profiler);
+            if (seed) interpreter.SetSeed(*seed);
+            return interpreter.Exec();
+        }
+    }
+}
+
+int Execute(Backend backend, const IR& ir, std::ostream& os) {
+    OutputBuffer out(os);
+    return Execute(backend, ir, out);
+}
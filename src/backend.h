@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string_view>
+
+#include "ir.h"
+#include "output_buffer.h"
+#include "sampling_profiler.h"
+
+// Execution engines able to run a checked IR. Jit is the tree walker with
+// tier-up of hot functions to native code.
+enum class Backend { TreeWalker, Bytecode, Jit };
+
+std::optional<Backend> ParseBackend(std::string_view name);
+
+// Runs the program with the selected engine. Returns the exit code of main.
+// A profiler samples the tree walker, and the JIT until functions tier up;
+// the bytecode VM ignores it. Without a seed, rand() differs from run to
+// run.
+int Execute(Backend backend, const IR& ir, OutputBuffer& out,
+            SamplingProfiler* profiler = nullptr,
+            std::optional<uint64_t> seed = std::nullopt);
+// Same, with the output buffered until main returns and then written to os.
+int Execute(Backend backend, const IR& ir, std::ostream& os);
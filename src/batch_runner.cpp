@@ -0,0 +1,74 @@
+#include "batch_runner.h"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include "driver.h"
+#include "output_buffer.h"
+#include "thread_pool.h"
+
+std::vector<BatchResult> BatchRunner::Run(
+    const std::vector<std::string>& paths) {
+    std::vector<BatchResult> results(paths.size());
+    ThreadPool pool(options_.jobs);
+    for (size_t i = 0; i < paths.size(); ++i) {
+        pool.Submit([this, &paths, &results, i] {
+            results[i] = RunOne(paths[i]);
+        });
+    }
+    pool.Wait();
+    return results;
+}
+
+BatchResult BatchRunner::RunOne(const std::string& path) const {
+    BatchResult result;
+    result.path = path;
+
+    std::ostringstream output;
+    std::ostringstream diagnostics;
+    try {
+        Driver driver;
+        driver.SetInlineBudget(options_.inline_budget);
+        // Programs already run in parallel.
+        driver.SetJobs(1);
+        if (options_.seed) driver.SetSeed(*options_.seed);
+        driver.SetDiagnostics(diagnostics);
+        result.exit_code = driver.RunFile(path);
+        result.failed = result.exit_code != 0;
+        if (!result.failed) {
+            OutputBuffer out(output, OutputBuffer::FlushPolicy::Exit);
+            result.exit_code = driver.Execute(options_.backend, out);
+        }
+    } catch (const std::exception& ex) {
+        // The output buffer is flushed while unwinding, so the output
+        // printed before the error is kept.
+        diagnostics << ex.what() << '\n';
+        result.exit_code = 1;
+        result.failed = true;
+    }
+    result.output = output.str();
+    result.diagnostics = diagnostics.str();
+    return result;
+}
+
+std::vector<std::string> ReadManifest(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) throw std::runtime_error("Cannot open " + path);
+
+    std::string dir;
+    if (auto slash = path.rfind('/'); slash != std::string::npos) {
+        dir = path.substr(0, slash + 1);
+    }
+
+    std::vector<std::string> paths;
+    std::string line;
+    while (std::getline(file, line)) {
+        auto begin = line.find_first_not_of(" \t\r");
+        if (begin == std::string::npos || line[begin] == '#') continue;
+        auto end = line.find_last_not_of(" \t\r");
+        line = line.substr(begin, end - begin + 1);
+        paths.push_back(line[0] == '/' ? line : dir + line);
+    }
+    return paths;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "backend.h"
+#include "inliner.h"
+
+// Outcome of compiling and running one program of a batch.
+struct BatchResult {
+    std::string path;
+    // Exit code of main, or the driver's code when compilation failed.
+    int exit_code = 0;
+    // The program did not compile or stopped with a runtime error. Main may
+    // return any value, so exit_code alone does not tell.
+    bool failed = false;
+    // What the program printed.
+    std::string output;
+    // Syntax, semantic and runtime errors.
+    std::string diagnostics;
+};
+
+// Compiles and runs many programs on a thread pool. Every program gets its
+// own Driver, Interpreter and output buffer, so programs share nothing but
+// the symbol interner.
+class BatchRunner {
+   public:
+    struct Options {
+        Backend backend = Backend::TreeWalker;
+        int inline_budget = Inliner::kDefaultBudget;
+        // Worker threads; 0 for one per hardware thread.
+        size_t jobs = 0;
+        // Every program starts rand() from this seed, so the output does
+        // not depend on which worker runs it.
+        std::optional<uint64_t> seed;
+    };
+
+    explicit BatchRunner(Options options) : options_(options) {}
+
+    // Results are in the order of paths, whatever order the programs
+    // finish in.
+    std::vector<BatchResult> Run(const std::vector<std::string>& paths);
+
+   private:
+    BatchResult RunOne(const std::string& path) const;
+
+    Options options_;
+};
+
+// Source paths listed in a manifest, one per line. Blank lines and lines
+// starting with # are skipped, and relative paths are taken relative to
+// the manifest. Throws std::runtime_error if it cannot be read.
+std::vector<std::string> ReadManifest(const std::string& path);
@@ -0,0 +1,393 @@
+#include "bounds_check_eliminator.h"
+
+#include <algorithm>
+#include <climits>
+#include <utility>
+
+#include "ast/arithmetic_op.h"
+#include "ast/array.h"
+#include "ast/assign.h"
+#include "ast/fun_call.h"
+#include "ast/function.h"
+#include "ast/if_then_else.h"
+#include "ast/integer.h"
+#include "ast/logic_op.h"
+#include "ast/print.h"
+#include "ast/program.h"
+#include "ast/return.h"
+#include "ast/var.h"
+#include "ast/while.h"
+
+namespace {
+
+bool IsLocal(const AST::VarRef& ref) {
+    return ref.scope == AST::VarRef::Scope::Local;
+}
+
+// Adds the local slots stored to by stmts to slots.
+void CollectWrites(const AST::Statements& stmts,
+                   std::unordered_set<int>* slots) {
+    for (auto stmt : stmts) {
+        const AST::VarRef* ref = nullptr;
+        switch (stmt->node_type) {
+            case AST::NodeType::Assign:
+                ref = &static_cast<AST::Assign*>(stmt.get())->ref;
+                break;
+            case AST::NodeType::ArrayDeclaration:
+                ref = &static_cast<AST::ArrayDeclaration*>(stmt.get())->ref;
+                break;
+            case AST::NodeType::VarDef:
+                ref = &static_cast<AST::VarDef*>(stmt.get())->ref;
+                break;
+            case AST::NodeType::IfThenElse: {
+                auto* branch = static_cast<AST::IfThenElse*>(stmt.get());
+                CollectWrites(branch->then_branch, slots);
+                CollectWrites(branch->else_branch, slots);
+                break;
+            }
+            case AST::NodeType::While:
+                CollectWrites(static_cast<AST::While*>(stmt.get())->body,
+                              slots);
+                break;
+            default:
+                break;
+        }
+        if (ref && IsLocal(*ref)) slots->insert(ref->index);
+    }
+}
+
+// Whether expr is `slot + c` or `c + slot` with a literal c >= 0.
+bool IsIncrement(const AST::Expr* expr, int slot) {
+    if (expr->node_type != AST::NodeType::ArithOp) return false;
+    auto* op = static_cast<const AST::ArithOp*>(expr);
+    if (op->op != AST::Operator::Add) return false;
+
+    auto is_slot = [slot](const AST::Expr* node) {
+        if (node->node_type != AST::NodeType::Var) return false;
+        auto& ref = static_cast<const AST::Var*>(node)->ref;
+        return IsLocal(ref) && ref.index == slot;
+    };
+    auto is_step = [](const AST::Expr* node) {
+        return node->node_type == AST::NodeType::Integer &&
+               static_cast<const AST::Integer*>(node)->value >= 0;
+    };
+    return (is_slot(op->lhs.get()) && is_step(op->rhs.get())) ||
+           (is_step(op->lhs.get()) && is_slot(op->rhs.get()));
+}
+
+// Whether every store to slot in stmts is an increment outside nested
+// loops, so slot never decreases over an iteration.
+bool IsInduction(const AST::Statements& stmts, int slot, bool nested) {
+    for (auto stmt : stmts) {
+        switch (stmt->node_type) {
+            case AST::NodeType::Assign: {
+                auto* assign = static_cast<AST::Assign*>(stmt.get());
+                if (!IsLocal(assign->ref) || assign->ref.index != slot) break;
+                if (nested || !IsIncrement(assign->expr.get(), slot)) {
+                    return false;
+                }
+                break;
+            }
+            case AST::NodeType::ArrayDeclaration: {
+                auto* decl = static_cast<AST::ArrayDeclaration*>(stmt.get());
+                if (IsLocal(decl->ref) && decl->ref.index == slot) {
+                    return false;
+                }
+                break;
+            }
+            case AST::NodeType::VarDef: {
+                auto& ref = static_cast<AST::VarDef*>(stmt.get())->ref;
+                if (IsLocal(ref) && ref.index == slot) return false;
+                break;
+            }
+            case AST::NodeType::IfThenElse: {
+                auto* branch = static_cast<AST::IfThenElse*>(stmt.get());
+                if (!IsInduction(branch->then_branch, slot, nested) ||
+                    !IsInduction(branch->else_branch, slot, nested)) {
+                    return false;
+                }
+                break;
+            }
+            case AST::NodeType::While:
+                if (!IsInduction(static_cast<AST::While*>(stmt.get())->body,
+                                 slot, true)) {
+                    return false;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+void BoundsCheckEliminator::Run() {
+    auto* program = static_cast<AST::Program*>(ir_->GetAST().get());
+    for (auto global : program->globals) {
+        if (global->node_type == AST::NodeType::ArrayDeclaration) {
+            auto* decl = static_cast<AST::ArrayDeclaration*>(global.get());
+            global_arrays_[decl->ref.index] = decl->type.array_size;
+        }
+    }
+
+    for (auto global : program->globals) {
+        if (global->node_type != AST::NodeType::Function) continue;
+        auto* function = static_cast<AST::Function*>(global.get());
+
+        local_arrays_.clear();
+        for (size_t i = 0; i < function->args.size(); ++i) {
+            if (function->args[i].type.is_array) {
+                local_arrays_[i] = function->args[i].type.array_size;
+            }
+        }
+        State state;
+        Walk(function->body, &state);
+    }
+}
+
+void BoundsCheckEliminator::Walk(const AST::Statements& stmts,
+                                 State* state) {
+    for (auto stmt : stmts) {
+        Walk(stmt.get(), state);
+    }
+}
+
+void BoundsCheckEliminator::Walk(AST::ASTNode* node, State* state) {
+    switch (node->node_type) {
+        case AST::NodeType::ArrayAssignment: {
+            auto* assign = static_cast<AST::ArrayAssignment*>(node);
+            Visit(assign->index.get(), *state);
+            Visit(assign->expr.get(), *state);
+            if (mark_ && assign->check_bounds &&
+                InBounds(assign->index.get(), assign->ref, *state)) {
+                assign->check_bounds = false;
+                ++eliminated_count_;
+            }
+            break;
+        }
+        case AST::NodeType::ArrayDeclaration: {
+            auto* decl = static_cast<AST::ArrayDeclaration*>(node);
+            if (IsLocal(decl->ref)) {
+                local_arrays_[decl->ref.index] = decl->type.array_size;
+                state->erase(decl->ref.index);
+            }
+            break;
+        }
+        case AST::NodeType::Assign: {
+            auto* assign = static_cast<AST::Assign*>(node);
+            Visit(assign->expr.get(), *state);
+            if (!IsLocal(assign->ref)) break;
+
+            int slot = assign->ref.index;
+            auto range = RangeOf(assign->expr.get(), *state);
+            if (range) {
+                (*state)[slot] = *range;
+            } else {
+                state->erase(slot);
+                if (induction_.count(slot)) overflowed_.insert(slot);
+            }
+            break;
+        }
+        case AST::NodeType::IfThenElse: {
+            auto* branch = static_cast<AST::IfThenElse*>(node);
+            Visit(branch->condition.get(), *state);
+            State then_state = *state;
+            Walk(branch->then_branch, &then_state);
+            Walk(branch->else_branch, state);
+
+            // Keep the slots known on both paths.
+            for (auto iter = state->begin(); iter != state->end();) {
+                auto other = then_state.find(iter->first);
+                if (other == then_state.end()) {
+                    iter = state->erase(iter);
+                    continue;
+                }
+                iter->second.lo = std::min(iter->second.lo, other->second.lo);
+                iter->second.hi = std::max(iter->second.hi, other->second.hi);
+                ++iter;
+            }
+            break;
+        }
+        case AST::NodeType::Print:
+            Visit(static_cast<AST::Print*>(node)->expr.get(), *state);
+            break;
+        case AST::NodeType::Return: {
+            auto* ret = static_cast<AST::Return*>(node);
+            if (ret->expr) Visit(ret->expr.get(), *state);
+            break;
+        }
+        case AST::NodeType::VarDef: {
+            auto& ref = static_cast<AST::VarDef*>(node)->ref;
+            if (IsLocal(ref)) state->erase(ref.index);
+            break;
+        }
+        case AST::NodeType::While:
+            WalkLoop(static_cast<AST::While*>(node), state);
+            break;
+        default:
+            Visit(node, *state);
+    }
+}
+
+void BoundsCheckEliminator::WalkLoop(AST::While* node, State* state) {
+    // State at the loop head, valid on entry and after every iteration:
+    // slots stored to in the body are forgotten, except induction
+    // variables, which keep their lower bound.
+    std::unordered_set<int> writes;
+    CollectWrites(node->body, &writes);
+
+    State head = *state;
+    std::unordered_set<int> induction;
+    for (int slot : writes) {
+        auto iter = head.find(slot);
+        if (iter != head.end() && IsInduction(node->body, slot, false)) {
+            iter->second.hi = INT_MAX;
+            induction.insert(slot);
+        } else {
+            head.erase(slot);
+        }
+    }
+
+    // The condition bounds the induction variables inside the body.
+    auto refine = [this, node](State body) {
+        if (node->condition->node_type != AST::NodeType::LogicOp) return body;
+        auto* cond = static_cast<AST::LogicOp*>(node->condition.get());
+        auto* var = cond->lhs.get();
+        auto* bound = cond->rhs.get();
+        if (cond->op == AST::Operator::Greater) std::swap(var, bound);
+        if (cond->op == AST::Operator::Equal ||
+            var->node_type != AST::NodeType::Var) {
+            return body;
+        }
+
+        auto& ref = static_cast<AST::Var*>(var)->ref;
+        auto range = RangeOf(bound, body);
+        auto iter = body.find(ref.index);
+        if (IsLocal(ref) && range && iter != body.end()) {
+            iter->second.hi = std::min(iter->second.hi, range->hi - 1);
+        }
+        return body;
+    };
+
+    // An increment may overflow when nothing bounds the variable; it is
+    // then no induction variable, and the body is walked again without
+    // it before any access is marked.
+    bool mark = std::exchange(mark_, false);
+    auto outer_induction = std::exchange(induction_, induction);
+    auto outer_overflowed = std::exchange(overflowed_, {});
+    while (true) {
+        State body = refine(head);
+        Walk(node->body, &body);
+        if (overflowed_.empty()) break;
+        for (int slot : overflowed_) {
+            head.erase(slot);
+            induction_.erase(slot);
+        }
+        overflowed_.clear();
+    }
+    mark_ = mark;
+    induction_ = std::move(outer_induction);
+    overflowed_ = std::move(outer_overflowed);
+
+    Visit(node->condition.get(), head);
+    State body = refine(head);
+    Walk(node->body, &body);
+
+    *state = std::move(head);
+}
+
+void BoundsCheckEliminator::Visit(AST::ASTNode* node, const State& state) {
+    switch (node->node_type) {
+        case AST::NodeType::ArithOp: {
+            auto* op = static_cast<AST::ArithOp*>(node);
+            Visit(op->lhs.get(), state);
+            Visit(op->rhs.get(), state);
+            break;
+        }
+        case AST::NodeType::ArrayAccess: {
+            auto* access = static_cast<AST::ArrayAccess*>(node);
+            Visit(access->index.get(), state);
+            if (mark_ && access->check_bounds &&
+                InBounds(access->index.get(), access->ref, state)) {
+                access->check_bounds = false;
+                ++eliminated_count_;
+            }
+            break;
+        }
+        case AST::NodeType::FunCall:
+            for (auto arg : static_cast<AST::FunCall*>(node)->args) {
+                Visit(arg.get(), state);
+            }
+            break;
+        case AST::NodeType::LogicOp: {
+            auto* op = static_cast<AST::LogicOp*>(node);
+            Visit(op->lhs.get(), state);
+            Visit(op->rhs.get(), state);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+bool BoundsCheckEliminator::InBounds(const AST::ASTNode* index,
+                                     const AST::VarRef& ref,
+                                     const State& state) const {
+    const auto& arrays = IsLocal(ref) ? local_arrays_ : global_arrays_;
+    auto size = arrays.find(ref.index);
+    auto range = RangeOf(index, state);
+    return size != arrays.end() && range && range->lo >= 0 &&
+           range->hi < size->second;
+}
+
+std::optional<BoundsCheckEliminator::Range> BoundsCheckEliminator::RangeOf(
+    const AST::ASTNode* node, const State& state) const {
+    switch (node->node_type) {
+        case AST::NodeType::Integer: {
+            int64_t value = static_cast<const AST::Integer*>(node)->value;
+            return Range{value, value};
+        }
+        case AST::NodeType::Var: {
+            auto& ref = static_cast<const AST::Var*>(node)->ref;
+            auto iter = state.find(ref.index);
+            if (!IsLocal(ref) || iter == state.end()) return std::nullopt;
+            return iter->second;
+        }
+        case AST::NodeType::ArithOp:
+            break;
+        default:
+            return std::nullopt;
+    }
+
+    auto* op = static_cast<const AST::ArithOp*>(node);
+    auto lhs = RangeOf(op->lhs.get(), state);
+    auto rhs = RangeOf(op->rhs.get(), state);
+    if (!lhs || !rhs) return std::nullopt;
+
+    bool literal_divisor = rhs->lo == rhs->hi && rhs->lo > 0;
+    Range range;
+    if (op->op == AST::Operator::Add) {
+        range = {lhs->lo + rhs->lo, lhs->hi + rhs->hi};
+    } else if (op->op == AST::Operator::Sub) {
+        range = {lhs->lo - rhs->hi, lhs->hi - rhs->lo};
+    } else if (op->op == AST::Operator::Mul) {
+        int64_t products[] = {lhs->lo * rhs->lo, lhs->lo * rhs->hi,
+                              lhs->hi * rhs->lo, lhs->hi * rhs->hi};
+        range = {*std::min_element(std::begin(products), std::end(products)),
+                 *std::max_element(std::begin(products), std::end(products))};
+    } else if (op->op == AST::Operator::Div && literal_divisor) {
+        range = {lhs->lo / rhs->lo, lhs->hi / rhs->lo};
+    } else if (op->op == AST::Operator::Mod && literal_divisor) {
+        int64_t max = rhs->lo - 1;
+        range = lhs->lo >= 0 ? Range{0, std::min(lhs->hi, max)}
+                             : Range{-max, max};
+    } else {
+        return std::nullopt;
+    }
+
+    // Runtime arithmetic wraps around, so a range is only exact within int.
+    if (range.lo < INT_MIN || range.hi > INT_MAX) return std::nullopt;
+    return range;
+}
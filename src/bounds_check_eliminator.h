@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ast/ast.h"
+#include "ast/var_ref.h"
+#include "ir.h"
+
+// Optimization pass run last, on the final tree. It tracks value ranges
+// of local ints through each function and clears check_bounds on array
+// accesses and assignments whose index is provably within the declared
+// array size; the backends then index the array without checking.
+//
+// Loops are handled through their induction variables: locals whose only
+// stores in the loop body are `i = i + c` with a non-negative literal c
+// keep their lower bound across iterations, and a `i < n` condition gives
+// the upper bound inside the body, as in
+//
+//   i = 0;
+//   while (i < 80) { a[i + j * 80] = 0; i = i + 1; }
+class BoundsCheckEliminator {
+   public:
+    explicit BoundsCheckEliminator(IR* ir) : ir_(ir) {}
+
+    void Run();
+
+    // Number of array accesses and assignments left without a check.
+    int EliminatedCount() const { return eliminated_count_; }
+
+   private:
+    struct Range {
+        int64_t lo;
+        int64_t hi;
+    };
+    // Known ranges of local int slots at a program point.
+    using State = std::unordered_map<int, Range>;
+
+    void Walk(const AST::Statements& stmts, State* state);
+    void Walk(AST::ASTNode* node, State* state);
+    void WalkLoop(AST::While* node, State* state);
+
+    // Checks the array accesses in the expression node.
+    void Visit(AST::ASTNode* node, const State& state);
+    // Whether index is within the array bound to ref.
+    bool InBounds(const AST::ASTNode* index, const AST::VarRef& ref,
+                  const State& state) const;
+
+    std::optional<Range> RangeOf(const AST::ASTNode* node,
+                                 const State& state) const;
+
+    IR* ir_;
+    int eliminated_count_ = 0;
+
+    // Declared sizes of the arrays in scope, by slot.
+    std::unordered_map<int, int> global_arrays_;
+    std::unordered_map<int, int> local_arrays_;
+
+    // Accesses are only marked once loop invariants have been validated.
+    bool mark_ = true;
+    // Induction variables of the loop being validated, and the ones whose
+    // increment may overflow.
+    std::unordered_set<int> induction_;
+    std::unordered_set<int> overflowed_;
+};
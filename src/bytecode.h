@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ast/ast.h"
+#include "value.h"
+
+namespace Bytecode {
+
+// Register machine instruction set. Operands a, b, c are frame registers
+// unless stated otherwise.
+enum class OpCode : uint8_t {
+    LoadConst,    // a = constants[b]
+    LoadGlobal,   // a = globals[b]
+    StoreGlobal,  // globals[a] = b
+    Move,         // a = b
+    Clear,        // a = None
+    CheckInit,    // fail if a is None
+    NewArray,     // a = new array of b zeroed ints
+    Add,          // a = b + c
+    Sub,          // a = b - c
+    Mul,          // a = b * c
+    Div,          // a = b / c
+    Mod,          // a = b % c
+    Less,         // a = b < c
+    Greater,      // a = b > c
+    Equal,        // a = b == c
+    Jump,         // pc = a
+    JumpIfFalse,  // if (!a) pc = b
+    ArrayLoad,    // a = b[c]
+    ArrayStore,   // a[b] = c
+    // Same as ArrayLoad and ArrayStore for indices proven in bounds.
+    ArrayLoadUnchecked,
+    ArrayStoreUnchecked,
+    Call,         // a = functions[b](c, c + 1, ...)
+    Return,       // return a
+    ReturnNone,   // return
+    Print,        // print a
+    Rand,         // a = rand()
+};
+
+struct Instruction {
+    OpCode op;
+    int32_t a = 0;
+    int32_t b = 0;
+    int32_t c = 0;
+};
+
+struct Function {
+    std::string name;
+    int num_params = 0;
+    int frame_size = 0;
+    std::vector<Instruction> code;
+    // Source node of every instruction, used for error reporting only.
+    std::vector<const AST::ASTNode*> origins;
+};
+
+struct Module {
+    std::vector<Function> functions;
+    std::vector<Value> constants;
+    int globals_count = 0;
+    int init_function = -1;
+    int main_function = -1;
+};
+
+}  // namespace Bytecode
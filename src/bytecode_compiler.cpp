@@ -0,0 +1,422 @@
+#include "bytecode_compiler.h"
+
+#include <algorithm>
+
+#include "ast/arithmetic_op.h"
+#include "ast/array.h"
+#include "ast/assign.h"
+#include "ast/bool_literal.h"
+#include "ast/fun_call.h"
+#include "ast/function.h"
+#include "ast/if_then_else.h"
+#include "ast/integer.h"
+#include "ast/logic_op.h"
+#include "ast/print.h"
+#include "ast/program.h"
+#include "ast/rand.h"
+#include "ast/return.h"
+#include "ast/string_literal.h"
+#include "ast/var.h"
+#include "ast/while.h"
+
+using Bytecode::OpCode;
+
+Bytecode::Module BytecodeCompiler::Compile() {
+    auto* program = static_cast<AST::Program*>(ir_.GetAST().get());
+
+    std::vector<AST::Function*> functions;
+    for (auto global : program->globals) {
+        if (global->node_type == AST::NodeType::Function) {
+            auto* func = static_cast<AST::Function*>(global.get());
+            functions_[func->name] = functions.size();
+            functions.push_back(func);
+        }
+    }
+    module_.functions.resize(functions.size() + 1);
+    module_.globals_count = ir_.GetGlobalCount();
+
+    // Global declarations run in a synthetic init function.
+    module_.init_function = functions.size();
+    function_ = &module_.functions[module_.init_function];
+    function_->name = "<init>";
+    next_register_ = 0;
+    for (auto global : program->globals) {
+        if (global->node_type == AST::NodeType::ArrayDeclaration) {
+            auto* decl = static_cast<AST::ArrayDeclaration*>(global.get());
+            int reg = NewRegister();
+            Emit(OpCode::NewArray, reg, decl->type.array_size, 0, decl);
+            Emit(OpCode::StoreGlobal, decl->ref.index, reg, 0, decl);
+            next_register_ = 0;
+        }
+    }
+    Emit(OpCode::ReturnNone, 0, 0, 0, program);
+
+    for (size_t i = 0; i < functions.size(); ++i) {
+        CompileFunction(functions[i], &module_.functions[i]);
+    }
+
+    auto main_iter = functions_.find(AST::Symbol("main"));
+    if (main_iter == functions_.end()) {
+        Error(program, "main function undefined");
+    }
+    module_.main_function = main_iter->second;
+
+    return std::move(module_);
+}
+
+void BytecodeCompiler::CompileFunction(AST::Function* node,
+                                       Bytecode::Function* function) {
+    function_ = function;
+    function_->name = node->name.Str();
+    function_->num_params = node->args.size();
+    function_->frame_size = node->frame_size;
+    next_register_ = node->frame_size;
+    initialized_.clear();
+
+    for (size_t i = 0; i < node->args.size(); ++i) {
+        SetInitialized(i, true);
+    }
+
+    for (auto stmt : node->body) {
+        CompileStmt(stmt.get());
+    }
+    Emit(OpCode::ReturnNone, 0, 0, 0, node);
+}
+
+void BytecodeCompiler::CompileStmt(AST::ASTNode* node) {
+    int mark = next_register_;
+    switch (node->node_type) {
+        case AST::NodeType::ArrayAssignment:
+            CompileStmt(static_cast<AST::ArrayAssignment*>(node));
+            break;
+        case AST::NodeType::ArrayDeclaration:
+            CompileStmt(static_cast<AST::ArrayDeclaration*>(node));
+            break;
+        case AST::NodeType::Assign:
+            CompileStmt(static_cast<AST::Assign*>(node));
+            break;
+        case AST::NodeType::IfThenElse:
+            CompileStmt(static_cast<AST::IfThenElse*>(node));
+            break;
+        case AST::NodeType::Print:
+            CompileStmt(static_cast<AST::Print*>(node));
+            break;
+        case AST::NodeType::Return:
+            CompileStmt(static_cast<AST::Return*>(node));
+            break;
+        case AST::NodeType::VarDef:
+            CompileStmt(static_cast<AST::VarDef*>(node));
+            break;
+        case AST::NodeType::While:
+            CompileStmt(static_cast<AST::While*>(node));
+            break;
+        case AST::NodeType::Function:
+            Error(node, "a function-definition is not allowed here");
+            break;
+        default:
+            CompileExpr(node);
+    }
+    next_register_ = mark;
+}
+
+void BytecodeCompiler::CompileStmt(AST::ArrayAssignment* node) {
+    int array = ArrayRegister(node, node->ref);
+    int index = CompileExpr(node->index.get());
+    int value = CompileExpr(node->expr.get());
+    auto op = node->check_bounds ? OpCode::ArrayStore
+                                 : OpCode::ArrayStoreUnchecked;
+    Emit(op, array, index, value, node);
+}
+
+void BytecodeCompiler::CompileStmt(AST::ArrayDeclaration* node) {
+    Emit(OpCode::NewArray, node->ref.index, node->type.array_size, 0, node);
+    SetInitialized(node->ref.index, true);
+}
+
+void BytecodeCompiler::CompileStmt(AST::Assign* node) {
+    if (!node->ref.IsGlobal()) {
+        CompileExpr(node->expr.get(), node->ref.index);
+        SetInitialized(node->ref.index, true);
+        return;
+    }
+    int value = CompileExpr(node->expr.get());
+    Emit(OpCode::StoreGlobal, node->ref.index, value, 0, node);
+}
+
+void BytecodeCompiler::CompileStmt(AST::IfThenElse* node) {
+    int cond = CompileExpr(node->condition.get());
+    size_t jump_else = Emit(OpCode::JumpIfFalse, cond, 0, 0, node);
+
+    auto initialized = initialized_;
+    CompileBlock(node->then_branch);
+    initialized_ = initialized;
+
+    if (node->else_branch.empty()) {
+        function_->code[jump_else].b = function_->code.size();
+        return;
+    }
+
+    size_t jump_end = Emit(OpCode::Jump, 0, 0, 0, node);
+    function_->code[jump_else].b = function_->code.size();
+    CompileBlock(node->else_branch);
+    initialized_ = initialized;
+    function_->code[jump_end].a = function_->code.size();
+}
+
+void BytecodeCompiler::CompileStmt(AST::Print* node) {
+    int value = CompileExpr(node->expr.get());
+    Emit(OpCode::Print, value, 0, 0, node);
+}
+
+void BytecodeCompiler::CompileStmt(AST::Return* node) {
+    if (!node->expr) {
+        Emit(OpCode::ReturnNone, 0, 0, 0, node);
+        return;
+    }
+    int value = CompileExpr(node->expr.get());
+    Emit(OpCode::Return, value, 0, 0, node);
+}
+
+void BytecodeCompiler::CompileStmt(AST::VarDef* node) {
+    Emit(OpCode::Clear, node->ref.index, 0, 0, node);
+    SetInitialized(node->ref.index, false);
+}
+
+void BytecodeCompiler::CompileStmt(AST::While* node) {
+    size_t loop = function_->code.size();
+    int mark = next_register_;
+    int cond = CompileExpr(node->condition.get());
+    size_t jump_end = Emit(OpCode::JumpIfFalse, cond, 0, 0, node);
+    next_register_ = mark;
+
+    auto initialized = initialized_;
+    CompileBlock(node->body);
+    initialized_ = initialized;
+
+    Emit(OpCode::Jump, loop, 0, 0, node);
+    function_->code[jump_end].b = function_->code.size();
+}
+
+void BytecodeCompiler::CompileBlock(const AST::Statements& stmts) {
+    for (auto stmt : stmts) {
+        CompileStmt(stmt.get());
+    }
+}
+
+int BytecodeCompiler::CompileExpr(AST::ASTNode* node, int dst) {
+    switch (node->node_type) {
+        case AST::NodeType::ArithOp:
+            return CompileExpr(static_cast<AST::ArithOp*>(node), dst);
+        case AST::NodeType::ArrayAccess:
+            return CompileExpr(static_cast<AST::ArrayAccess*>(node), dst);
+        case AST::NodeType::BoolLiteral:
+            return CompileExpr(static_cast<AST::BoolLiteral*>(node), dst);
+        case AST::NodeType::FunCall:
+            return CompileExpr(static_cast<AST::FunCall*>(node), dst);
+        case AST::NodeType::Integer:
+            return CompileExpr(static_cast<AST::Integer*>(node), dst);
+        case AST::NodeType::LogicOp:
+            return CompileExpr(static_cast<AST::LogicOp*>(node), dst);
+        case AST::NodeType::Rand:
+            return CompileExpr(static_cast<AST::Rand*>(node), dst);
+        case AST::NodeType::StringLiteral:
+            return CompileExpr(static_cast<AST::StringLiteral*>(node), dst);
+        case AST::NodeType::Var:
+            return CompileExpr(static_cast<AST::Var*>(node), dst);
+        default:
+            Error(node, "unknown expression node");
+    }
+    return -1;
+}
+
+int BytecodeCompiler::CompileExpr(AST::ArithOp* node, int dst) {
+    int lhs = CompileExpr(node->lhs.get());
+    int rhs = CompileExpr(node->rhs.get());
+
+    OpCode op;
+    switch (node->op) {
+        case AST::Operator::Add:
+            op = OpCode::Add;
+            break;
+        case AST::Operator::Sub:
+            op = OpCode::Sub;
+            break;
+        case AST::Operator::Mul:
+            op = OpCode::Mul;
+            break;
+        case AST::Operator::Div:
+            op = OpCode::Div;
+            break;
+        case AST::Operator::Mod:
+            op = OpCode::Mod;
+            break;
+        default:
+            Error(node, "Unknown arith op: ", node->op);
+    }
+
+    dst = Target(dst);
+    Emit(op, dst, lhs, rhs, node);
+    return dst;
+}
+
+int BytecodeCompiler::CompileExpr(AST::ArrayAccess* node, int dst) {
+    int array = ArrayRegister(node, node->ref);
+    int index = CompileExpr(node->index.get());
+    dst = Target(dst);
+    auto op = node->check_bounds ? OpCode::ArrayLoad
+                                 : OpCode::ArrayLoadUnchecked;
+    Emit(op, dst, array, index, node);
+    return dst;
+}
+
+int BytecodeCompiler::CompileExpr(AST::BoolLiteral* node, int dst) {
+    dst = Target(dst);
+    Emit(OpCode::LoadConst, dst, BoolConstant(node->value), 0, node);
+    return dst;
+}
+
+int BytecodeCompiler::CompileExpr(AST::FunCall* node, int dst) {
+    auto iter = functions_.find(node->name);
+    if (iter == functions_.end()) {
+        Error(node, "'", node->name, "' was not declared in this scope");
+    }
+
+    dst = Target(dst);
+
+    // Arguments occupy consecutive registers which become the first
+    // registers of the callee frame.
+    int base = next_register_;
+    for (size_t i = 0; i < node->args.size(); ++i) {
+        int arg = NewRegister();
+        CompileExpr(node->args[i].get(), arg);
+        next_register_ = arg + 1;
+    }
+    Emit(OpCode::Call, dst, iter->second, base, node);
+    next_register_ = base;
+
+    return dst;
+}
+
+int BytecodeCompiler::CompileExpr(AST::Integer* node, int dst) {
+    dst = Target(dst);
+    Emit(OpCode::LoadConst, dst, IntConstant(node->value), 0, node);
+    return dst;
+}
+
+int BytecodeCompiler::CompileExpr(AST::LogicOp* node, int dst) {
+    int lhs = CompileExpr(node->lhs.get());
+    int rhs = CompileExpr(node->rhs.get());
+
+    OpCode op;
+    switch (node->op) {
+        case AST::Operator::Less:
+            op = OpCode::Less;
+            break;
+        case AST::Operator::Greater:
+            op = OpCode::Greater;
+            break;
+        case AST::Operator::Equal:
+            op = OpCode::Equal;
+            break;
+        default:
+            Error(node, "Unknown logic op: ", node->op);
+    }
+
+    dst = Target(dst);
+    Emit(op, dst, lhs, rhs, node);
+    return dst;
+}
+
+int BytecodeCompiler::CompileExpr(AST::Rand* node, int dst) {
+    dst = Target(dst);
+    Emit(OpCode::Rand, dst, 0, 0, node);
+    return dst;
+}
+
+int BytecodeCompiler::CompileExpr(AST::StringLiteral* node, int dst) {
+    dst = Target(dst);
+    Emit(OpCode::LoadConst, dst, StringConstant(node->value), 0, node);
+    return dst;
+}
+
+int BytecodeCompiler::CompileExpr(AST::Var* node, int dst) {
+    if (node->ref.IsGlobal()) {
+        int reg = Target(dst);
+        Emit(OpCode::LoadGlobal, reg, node->ref.index, 0, node);
+        if (!node->type.is_array) {
+            Emit(OpCode::CheckInit, reg, 0, 0, node);
+        }
+        return reg;
+    }
+
+    int reg = node->ref.index;
+
+    if (!IsInitialized(reg)) {
+        Emit(OpCode::CheckInit, reg, 0, 0, node);
+    }
+    if (dst >= 0 && dst != reg) {
+        Emit(OpCode::Move, dst, reg, 0, node);
+        return dst;
+    }
+    return reg;
+}
+
+size_t BytecodeCompiler::Emit(OpCode op, int32_t a, int32_t b, int32_t c,
+                              const AST::ASTNode* origin) {
+    function_->code.push_back({op, a, b, c});
+    function_->origins.push_back(origin);
+    return function_->code.size() - 1;
+}
+
+int BytecodeCompiler::NewRegister() {
+    int reg = next_register_++;
+    function_->frame_size = std::max(function_->frame_size, next_register_);
+    return reg;
+}
+
+int BytecodeCompiler::ArrayRegister(AST::ASTNode* node,
+                                    const AST::VarRef& ref) {
+    if (!ref.IsGlobal()) return ref.index;
+
+    int reg = NewRegister();
+    Emit(OpCode::LoadGlobal, reg, ref.index, 0, node);
+    return reg;
+}
+
+int BytecodeCompiler::IntConstant(int value) {
+    auto [iter, inserted] =
+        int_constants_.emplace(value, module_.constants.size());
+    if (inserted) {
+        module_.constants.push_back(Value::Int(value));
+    }
+    return iter->second;
+}
+
+int BytecodeCompiler::BoolConstant(bool value) {
+    int& index = bool_constants_[value];
+    if (index < 0) {
+        index = module_.constants.size();
+        module_.constants.push_back(Value::Bool(value));
+    }
+    return index;
+}
+
+int BytecodeCompiler::StringConstant(const std::string& value) {
+    auto [iter, inserted] =
+        string_constants_.emplace(value, module_.constants.size());
+    if (inserted) {
+        module_.constants.push_back(Value::String(value));
+    }
+    return iter->second;
+}
+
+bool BytecodeCompiler::IsInitialized(int reg) const {
+    return reg < static_cast<int>(initialized_.size()) && initialized_[reg];
+}
+
+void BytecodeCompiler::SetInitialized(int reg, bool value) {
+    if (reg >= static_cast<int>(initialized_.size())) {
+        initialized_.resize(reg + 1);
+    }
+    initialized_[reg] = value;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ast/ast.h"
+#include "ast/var_ref.h"
+#include "bytecode.h"
+#include "ir.h"
+
+// Lowers the semantically checked AST into register bytecode. Local slots
+// resolved by semantic analysis are used as registers directly, temporaries
+// are allocated above them and released after each statement.
+class BytecodeCompiler {
+   public:
+    explicit BytecodeCompiler(const IR& ir) : ir_(ir) {}
+
+    Bytecode::Module Compile();
+
+   private:
+    void CompileFunction(AST::Function* node, Bytecode::Function* function);
+
+    void CompileStmt(AST::ASTNode* node);
+    void CompileStmt(AST::ArrayAssignment* node);
+    void CompileStmt(AST::ArrayDeclaration* node);
+    void CompileStmt(AST::Assign* node);
+    void CompileStmt(AST::IfThenElse* node);
+    void CompileStmt(AST::Print* node);
+    void CompileStmt(AST::Return* node);
+    void CompileStmt(AST::VarDef* node);
+    void CompileStmt(AST::While* node);
+    void CompileBlock(const AST::Statements& stmts);
+
+    // Compiles an expression and returns the register holding its value.
+    // When dst is not negative the value is placed into dst.
+    int CompileExpr(AST::ASTNode* node, int dst = -1);
+    int CompileExpr(AST::ArithOp* node, int dst);
+    int CompileExpr(AST::ArrayAccess* node, int dst);
+    int CompileExpr(AST::BoolLiteral* node, int dst);
+    int CompileExpr(AST::FunCall* node, int dst);
+    int CompileExpr(AST::Integer* node, int dst);
+    int CompileExpr(AST::LogicOp* node, int dst);
+    int CompileExpr(AST::Rand* node, int dst);
+    int CompileExpr(AST::StringLiteral* node, int dst);
+    int CompileExpr(AST::Var* node, int dst);
+
+    size_t Emit(Bytecode::OpCode op, int32_t a, int32_t b, int32_t c,
+                const AST::ASTNode* origin);
+
+    int NewRegister();
+    int Target(int dst) { return dst < 0 ? NewRegister() : dst; }
+
+    // Returns the register holding an array, loading globals into a
+    // temporary.
+    int ArrayRegister(AST::ASTNode* node, const AST::VarRef& ref);
+
+    int IntConstant(int value);
+    int BoolConstant(bool value);
+    int StringConstant(const std::string& value);
+
+    bool IsInitialized(int reg) const;
+    void SetInitialized(int reg, bool value);
+
+    template <typename... Args>
+    void Error(AST::ASTNode* node, Args... args) {
+        std::ostringstream oss;
+        oss << node->loc;
+        oss << ": ";
+        (oss << ... << args);
+        throw std::runtime_error(oss.str());
+    }
+
+    const IR& ir_;
+
+    Bytecode::Module module_;
+    Bytecode::Function* function_ = nullptr;
+
+    std::unordered_map<AST::Symbol, int> functions_;
+
+    // Registers proven to hold a value on every path reaching the current
+    // instruction; reads of other registers get a CheckInit.
+    std::vector<bool> initialized_;
+
+    std::unordered_map<int, int> int_constants_;
+    std::unordered_map<std::string, int> string_constants_;
+    int bool_constants_[2] = {-1, -1};
+
+    int next_register_ = 0;
+};
@@ -1,18 +1,19 @@
 #pragma once
 
 #include <stdexcept>
-#include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "ast/symbol.h"
+
 template <typename T>
 class CallStack {
    public:
     CallStack() { scopes.push_back({}); }
 
-    using ScopeMap = std::unordered_map<std::string, T>;
+    using ScopeMap = std::unordered_map<AST::Symbol, T>;
 
-    T* Declare(const std::string& name, const T& entry) {
+    T* Declare(AST::Symbol name, const T& entry) {
         if (auto iter = scopes.back().find(name); iter != scopes.back().end()) {
             return &iter->second;
         }
@@ -26,7 +27,7 @@ class CallStack {
         scopes.pop_back();
     }
 
-    T* Find(const std::string& name) {
+    T* Find(AST::Symbol name) {
         for (auto iter = scopes.rbegin(); iter != scopes.rend(); ++iter) {
             auto found = iter->find(name);
             if (found != iter->end()) return &found->second;
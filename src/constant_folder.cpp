@@ -0,0 +1,277 @@
+#include "constant_folder.h"
+
+#include <climits>
+#include <cstdint>
+
+#include "ast/arithmetic_op.h"
+#include "ast/array.h"
+#include "ast/assign.h"
+#include "ast/bool_literal.h"
+#include "ast/fun_call.h"
+#include "ast/function.h"
+#include "ast/if_then_else.h"
+#include "ast/integer.h"
+#include "ast/logic_op.h"
+#include "ast/print.h"
+#include "ast/program.h"
+#include "ast/return.h"
+#include "ast/var.h"
+#include "ast/while.h"
+
+namespace {
+
+bool IsLiteral(const AST::ASTNode* node) {
+    return node->node_type == AST::NodeType::Integer ||
+           node->node_type == AST::NodeType::BoolLiteral;
+}
+
+int LiteralValue(const AST::ASTNode* node) {
+    if (node->node_type == AST::NodeType::Integer) {
+        return static_cast<const AST::Integer*>(node)->value;
+    }
+    return static_cast<const AST::BoolLiteral*>(node)->value;
+}
+
+bool IsInteger(const AST::ASTNode* node, int value) {
+    return node->node_type == AST::NodeType::Integer &&
+           static_cast<const AST::Integer*>(node)->value == value;
+}
+
+template <typename T>
+std::shared_ptr<AST::Expr> MakeLiteral(int value, AST::Location loc) {
+    auto literal = std::make_shared<T>(value);
+    literal->loc = loc;
+    return literal;
+}
+
+// Whether node stores to the local slot index.
+bool WritesLocal(const AST::ASTNode* node, int index) {
+    auto writes = [index](const AST::VarRef& ref) {
+        return !ref.IsGlobal() && ref.index == index;
+    };
+    auto any = [index](const AST::Statements& stmts) {
+        for (auto stmt : stmts) {
+            if (WritesLocal(stmt.get(), index)) return true;
+        }
+        return false;
+    };
+
+    switch (node->node_type) {
+        case AST::NodeType::Assign:
+            return writes(static_cast<const AST::Assign*>(node)->ref);
+        case AST::NodeType::VarDef:
+            return writes(static_cast<const AST::VarDef*>(node)->ref);
+        case AST::NodeType::ArrayDeclaration:
+            return writes(static_cast<const AST::ArrayDeclaration*>(node)->ref);
+        case AST::NodeType::IfThenElse: {
+            auto* branch = static_cast<const AST::IfThenElse*>(node);
+            return any(branch->then_branch) || any(branch->else_branch);
+        }
+        case AST::NodeType::While:
+            return any(static_cast<const AST::While*>(node)->body);
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
+void ConstantFolder::Run() {
+    auto* program = static_cast<AST::Program*>(ir_->GetAST().get());
+    for (auto global : program->globals) {
+        if (global->node_type == AST::NodeType::Function) {
+            FoldFunction(static_cast<AST::Function*>(global.get()));
+        }
+    }
+}
+
+void ConstantFolder::FoldFunction(AST::Function* node) {
+    constants_.clear();
+    // Every newly found constant may turn more assignments into literals.
+    do {
+        AST::Statements body;
+        for (position_ = 0; position_ < node->body.size(); ++position_) {
+            FoldStmt(node->body[position_], &body);
+        }
+        node->body = std::move(body);
+    } while (CollectConstants(node->body));
+}
+
+bool ConstantFolder::CollectConstants(const AST::Statements& body) {
+    bool found = false;
+    for (size_t i = 0; i < body.size(); ++i) {
+        if (body[i]->node_type != AST::NodeType::Assign) continue;
+        auto* assign = static_cast<AST::Assign*>(body[i].get());
+        if (assign->ref.IsGlobal() || !IsLiteral(assign->expr.get())) continue;
+
+        int index = assign->ref.index;
+        auto iter = constants_.find(index);
+        if (iter != constants_.end() && iter->second.position == i) continue;
+
+        bool overwritten = false;
+        for (size_t j = i + 1; j < body.size() && !overwritten; ++j) {
+            overwritten = WritesLocal(body[j].get(), index);
+        }
+        if (overwritten) continue;
+
+        constants_[index] = {assign->expr, i};
+        found = true;
+    }
+    return found;
+}
+
+void ConstantFolder::FoldBlock(AST::Statements* stmts) {
+    AST::Statements folded;
+    for (auto stmt : *stmts) {
+        FoldStmt(stmt, &folded);
+    }
+    *stmts = std::move(folded);
+}
+
+void ConstantFolder::FoldStmt(std::shared_ptr<AST::ASTNode> node,
+                              AST::Statements* out) {
+    switch (node->node_type) {
+        case AST::NodeType::ArrayAssignment: {
+            auto* assign = static_cast<AST::ArrayAssignment*>(node.get());
+            Fold(assign->index);
+            Fold(assign->expr);
+            break;
+        }
+        case AST::NodeType::Assign:
+            Fold(static_cast<AST::Assign*>(node.get())->expr);
+            break;
+        case AST::NodeType::IfThenElse: {
+            auto* branch = static_cast<AST::IfThenElse*>(node.get());
+            Fold(branch->condition);
+            FoldBlock(&branch->then_branch);
+            FoldBlock(&branch->else_branch);
+            if (branch->condition->node_type == AST::NodeType::BoolLiteral) {
+                auto& taken = LiteralValue(branch->condition.get())
+                                  ? branch->then_branch
+                                  : branch->else_branch;
+                out->insert(out->end(), taken.begin(), taken.end());
+                return;
+            }
+            break;
+        }
+        case AST::NodeType::Print:
+            Fold(static_cast<AST::Print*>(node.get())->expr);
+            break;
+        case AST::NodeType::Return: {
+            auto* ret = static_cast<AST::Return*>(node.get());
+            if (ret->expr) Fold(ret->expr);
+            break;
+        }
+        case AST::NodeType::While: {
+            auto* loop = static_cast<AST::While*>(node.get());
+            Fold(loop->condition);
+            if (loop->condition->node_type == AST::NodeType::BoolLiteral &&
+                !LiteralValue(loop->condition.get())) {
+                return;
+            }
+            FoldBlock(&loop->body);
+            break;
+        }
+        case AST::NodeType::ArrayDeclaration:
+        case AST::NodeType::VarDef:
+            break;
+        default:
+            node = FoldExpr(node);
+    }
+    out->push_back(node);
+}
+
+std::shared_ptr<AST::ASTNode> ConstantFolder::FoldExpr(
+    std::shared_ptr<AST::ASTNode> node) {
+    switch (node->node_type) {
+        case AST::NodeType::ArithOp: {
+            auto* op = static_cast<AST::ArithOp*>(node.get());
+            Fold(op->lhs);
+            Fold(op->rhs);
+            auto* lhs = op->lhs.get();
+            auto* rhs = op->rhs.get();
+
+            if (lhs->node_type == AST::NodeType::Integer &&
+                rhs->node_type == AST::NodeType::Integer) {
+                // Wrap around like the 32-bit runtime arithmetic does.
+                auto a = static_cast<uint32_t>(LiteralValue(lhs));
+                auto b = static_cast<uint32_t>(LiteralValue(rhs));
+                int x = LiteralValue(lhs);
+                int y = LiteralValue(rhs);
+                if (op->op == AST::Operator::Add) {
+                    return MakeLiteral<AST::Integer>(a + b, op->loc);
+                } else if (op->op == AST::Operator::Sub) {
+                    return MakeLiteral<AST::Integer>(a - b, op->loc);
+                } else if (op->op == AST::Operator::Mul) {
+                    return MakeLiteral<AST::Integer>(a * b, op->loc);
+                }
+                // Division by zero is left to fail at run time.
+                if (y != 0 && !(x == INT_MIN && y == -1)) {
+                    if (op->op == AST::Operator::Div) {
+                        return MakeLiteral<AST::Integer>(x / y, op->loc);
+                    } else if (op->op == AST::Operator::Mod) {
+                        return MakeLiteral<AST::Integer>(x % y, op->loc);
+                    }
+                }
+                return node;
+            }
+
+            if (op->op == AST::Operator::Add) {
+                if (IsInteger(rhs, 0)) return op->lhs;
+                if (IsInteger(lhs, 0)) return op->rhs;
+            } else if (op->op == AST::Operator::Sub) {
+                if (IsInteger(rhs, 0)) return op->lhs;
+            } else if (op->op == AST::Operator::Mul) {
+                if (IsInteger(rhs, 1)) return op->lhs;
+                if (IsInteger(lhs, 1)) return op->rhs;
+            } else if (op->op == AST::Operator::Div) {
+                if (IsInteger(rhs, 1)) return op->lhs;
+            }
+            return node;
+        }
+        case AST::NodeType::ArrayAccess:
+            Fold(static_cast<AST::ArrayAccess*>(node.get())->index);
+            return node;
+        case AST::NodeType::FunCall:
+            for (auto& arg : static_cast<AST::FunCall*>(node.get())->args) {
+                Fold(arg);
+            }
+            return node;
+        case AST::NodeType::LogicOp: {
+            auto* op = static_cast<AST::LogicOp*>(node.get());
+            Fold(op->lhs);
+            Fold(op->rhs);
+            if (!IsLiteral(op->lhs.get()) || !IsLiteral(op->rhs.get())) {
+                return node;
+            }
+            int lhs = LiteralValue(op->lhs.get());
+            int rhs = LiteralValue(op->rhs.get());
+            if (op->op == AST::Operator::Less) {
+                return MakeLiteral<AST::BoolLiteral>(lhs < rhs, op->loc);
+            } else if (op->op == AST::Operator::Greater) {
+                return MakeLiteral<AST::BoolLiteral>(lhs > rhs, op->loc);
+            } else if (op->op == AST::Operator::Equal) {
+                return MakeLiteral<AST::BoolLiteral>(lhs == rhs, op->loc);
+            }
+            return node;
+        }
+        case AST::NodeType::Var: {
+            auto* var = static_cast<AST::Var*>(node.get());
+            if (var->ref.IsGlobal()) return node;
+            auto iter = constants_.find(var->ref.index);
+            if (iter == constants_.end() ||
+                iter->second.position >= position_) {
+                return node;
+            }
+            auto* literal = iter->second.literal.get();
+            if (literal->node_type == AST::NodeType::Integer) {
+                return MakeLiteral<AST::Integer>(LiteralValue(literal),
+                                                 var->loc);
+            }
+            return MakeLiteral<AST::BoolLiteral>(LiteralValue(literal),
+                                                 var->loc);
+        }
+        default:
+            return node;
+    }
+}
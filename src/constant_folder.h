@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+
+#include "ast/ast.h"
+#include "ast/expr.h"
+#include "ir.h"
+
+// Optimization pass over the checked AST, run before execution or codegen.
+// It folds arithmetic and comparisons on literals, simplifies identities
+// such as x + 0 and x * 1, replaces reads of locals that are assigned a
+// literal once at the top level of their function, and prunes if and
+// while statements whose condition is constant. Nodes are rewritten in
+// place, so every backend sees the simplified tree.
+class ConstantFolder {
+   public:
+    explicit ConstantFolder(IR* ir) : ir_(ir) {}
+
+    void Run();
+
+   private:
+    struct Constant {
+        std::shared_ptr<AST::Expr> literal;
+        // Top-level statement of the function assigning the literal; only
+        // reads in later statements are replaced.
+        size_t position;
+    };
+
+    void FoldFunction(AST::Function* node);
+    // Finds top-level assignments of literals that are never overwritten
+    // afterwards. Returns whether a new constant was found.
+    bool CollectConstants(const AST::Statements& body);
+
+    void FoldBlock(AST::Statements* stmts);
+    // Appends the folded statement to out; a pruned statement appends
+    // nothing, a constant if appends the statements of the taken branch.
+    void FoldStmt(std::shared_ptr<AST::ASTNode> node, AST::Statements* out);
+    std::shared_ptr<AST::ASTNode> FoldExpr(std::shared_ptr<AST::ASTNode> node);
+
+    template <typename T>
+    void Fold(std::shared_ptr<T>& node) {
+        node = std::static_pointer_cast<T>(FoldExpr(node));
+    }
+
+    IR* ir_;
+
+    std::unordered_map<int, Constant> constants_;
+    // Index of the top-level statement being folded.
+    size_t position_ = 0;
+};
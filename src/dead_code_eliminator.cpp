@@ -0,0 +1,291 @@
+#include "dead_code_eliminator.h"
+
+#include <algorithm>
+
+#include "ast/arithmetic_op.h"
+#include "ast/array.h"
+#include "ast/assign.h"
+#include "ast/bool_literal.h"
+#include "ast/fun_call.h"
+#include "ast/function.h"
+#include "ast/if_then_else.h"
+#include "ast/logic_op.h"
+#include "ast/print.h"
+#include "ast/program.h"
+#include "ast/return.h"
+#include "ast/var.h"
+#include "ast/while.h"
+
+namespace {
+
+// Adds the local slots node reads or writes to slots.
+void CollectReferences(const AST::ASTNode* node,
+                       std::unordered_set<int>* slots) {
+    auto add = [slots](const AST::VarRef& ref) {
+        if (!ref.IsGlobal()) slots->insert(ref.index);
+    };
+    auto add_all = [slots](const AST::Statements& stmts) {
+        for (auto stmt : stmts) CollectReferences(stmt.get(), slots);
+    };
+
+    switch (node->node_type) {
+        case AST::NodeType::ArithOp: {
+            auto* op = static_cast<const AST::ArithOp*>(node);
+            CollectReferences(op->lhs.get(), slots);
+            CollectReferences(op->rhs.get(), slots);
+            break;
+        }
+        case AST::NodeType::ArrayAccess: {
+            auto* access = static_cast<const AST::ArrayAccess*>(node);
+            add(access->ref);
+            CollectReferences(access->index.get(), slots);
+            break;
+        }
+        case AST::NodeType::ArrayAssignment: {
+            auto* assign = static_cast<const AST::ArrayAssignment*>(node);
+            add(assign->ref);
+            CollectReferences(assign->index.get(), slots);
+            CollectReferences(assign->expr.get(), slots);
+            break;
+        }
+        case AST::NodeType::Assign: {
+            auto* assign = static_cast<const AST::Assign*>(node);
+            add(assign->ref);
+            CollectReferences(assign->expr.get(), slots);
+            break;
+        }
+        case AST::NodeType::FunCall:
+            for (auto arg : static_cast<const AST::FunCall*>(node)->args) {
+                CollectReferences(arg.get(), slots);
+            }
+            break;
+        case AST::NodeType::IfThenElse: {
+            auto* branch = static_cast<const AST::IfThenElse*>(node);
+            CollectReferences(branch->condition.get(), slots);
+            add_all(branch->then_branch);
+            add_all(branch->else_branch);
+            break;
+        }
+        case AST::NodeType::LogicOp: {
+            auto* op = static_cast<const AST::LogicOp*>(node);
+            CollectReferences(op->lhs.get(), slots);
+            CollectReferences(op->rhs.get(), slots);
+            break;
+        }
+        case AST::NodeType::Print:
+            CollectReferences(static_cast<const AST::Print*>(node)->expr.get(),
+                              slots);
+            break;
+        case AST::NodeType::Return: {
+            auto* ret = static_cast<const AST::Return*>(node);
+            if (ret->expr) CollectReferences(ret->expr.get(), slots);
+            break;
+        }
+        case AST::NodeType::Var:
+            add(static_cast<const AST::Var*>(node)->ref);
+            break;
+        case AST::NodeType::While: {
+            auto* loop = static_cast<const AST::While*>(node);
+            CollectReferences(loop->condition.get(), slots);
+            add_all(loop->body);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+bool IsLiteral(const AST::ASTNode* node) {
+    return node->node_type == AST::NodeType::Integer ||
+           node->node_type == AST::NodeType::BoolLiteral ||
+           node->node_type == AST::NodeType::StringLiteral;
+}
+
+}  // namespace
+
+void DeadCodeEliminator::Run() {
+    auto* program = static_cast<AST::Program*>(ir_->GetAST().get());
+    for (auto global : program->globals) {
+        if (global->node_type == AST::NodeType::Function) {
+            EliminateFunction(static_cast<AST::Function*>(global.get()));
+        }
+    }
+}
+
+void DeadCodeEliminator::EliminateFunction(AST::Function* node) {
+    RemoveUnreachable(&node->body);
+    Liveness(&node->body, {}, true);
+
+    Slots referenced;
+    for (auto stmt : node->body) CollectReferences(stmt.get(), &referenced);
+    RemoveUnreferenced(&node->body, referenced);
+}
+
+bool DeadCodeEliminator::RemoveUnreachable(AST::Statements* stmts) {
+    for (size_t i = 0; i < stmts->size(); ++i) {
+        auto* stmt = (*stmts)[i].get();
+        bool completes = true;
+        switch (stmt->node_type) {
+            case AST::NodeType::Return:
+                completes = false;
+                break;
+            case AST::NodeType::IfThenElse: {
+                auto* branch = static_cast<AST::IfThenElse*>(stmt);
+                bool then_returns = RemoveUnreachable(&branch->then_branch);
+                bool else_returns = RemoveUnreachable(&branch->else_branch);
+                completes = !then_returns || !else_returns;
+                break;
+            }
+            case AST::NodeType::While: {
+                auto* loop = static_cast<AST::While*>(stmt);
+                RemoveUnreachable(&loop->body);
+                // There is no break, so while (true) only exits by return.
+                auto* cond = loop->condition.get();
+                completes =
+                    cond->node_type != AST::NodeType::BoolLiteral ||
+                    !static_cast<AST::BoolLiteral*>(cond)->value;
+                break;
+            }
+            default:
+                break;
+        }
+        if (!completes) {
+            for (size_t j = i + 1; j < stmts->size(); ++j) {
+                Remove((*stmts)[j].get(), "unreachable statement");
+            }
+            stmts->resize(i + 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+DeadCodeEliminator::Slots DeadCodeEliminator::Liveness(
+    AST::Statements* stmts, Slots live, bool remove) {
+    for (auto iter = stmts->rbegin(); iter != stmts->rend(); ++iter) {
+        live = Liveness(iter->get(), std::move(live), remove);
+    }
+    if (remove) {
+        stmts->erase(std::remove_if(stmts->begin(), stmts->end(),
+                                    [this](const auto& stmt) {
+                                        return dead_.count(stmt.get()) > 0;
+                                    }),
+                     stmts->end());
+    }
+    return live;
+}
+
+DeadCodeEliminator::Slots DeadCodeEliminator::Liveness(AST::ASTNode* node,
+                                                       Slots live,
+                                                       bool remove) {
+    switch (node->node_type) {
+        case AST::NodeType::Assign: {
+            auto* assign = static_cast<AST::Assign*>(node);
+            if (assign->ref.IsGlobal()) break;
+            if (!live.count(assign->ref.index) &&
+                IsLiteral(assign->expr.get())) {
+                if (remove) {
+                    dead_.insert(node);
+                    Remove(node, "dead store to '" + assign->var.Str() + "'");
+                }
+                return live;
+            }
+            live.erase(assign->ref.index);
+            CollectReferences(assign->expr.get(), &live);
+            return live;
+        }
+        case AST::NodeType::ArrayDeclaration: {
+            auto& ref = static_cast<AST::ArrayDeclaration*>(node)->ref;
+            if (!ref.IsGlobal()) live.erase(ref.index);
+            return live;
+        }
+        case AST::NodeType::VarDef: {
+            auto& ref = static_cast<AST::VarDef*>(node)->ref;
+            if (!ref.IsGlobal()) live.erase(ref.index);
+            return live;
+        }
+        case AST::NodeType::IfThenElse: {
+            auto* branch = static_cast<AST::IfThenElse*>(node);
+            auto result = Liveness(&branch->then_branch, live, remove);
+            auto other = Liveness(&branch->else_branch, live, remove);
+            result.insert(other.begin(), other.end());
+            CollectReferences(branch->condition.get(), &result);
+            return result;
+        }
+        case AST::NodeType::Return: {
+            // Nothing after a return is executed.
+            Slots result;
+            auto* ret = static_cast<AST::Return*>(node);
+            if (ret->expr) CollectReferences(ret->expr.get(), &result);
+            return result;
+        }
+        case AST::NodeType::While: {
+            auto* loop = static_cast<AST::While*>(node);
+            // Slots live at the condition: live after the loop or in the
+            // next iteration. Sets only grow, so this terminates.
+            Slots head = live;
+            CollectReferences(loop->condition.get(), &head);
+            while (true) {
+                auto next = Liveness(&loop->body, head, false);
+                next.insert(live.begin(), live.end());
+                CollectReferences(loop->condition.get(), &next);
+                if (next == head) break;
+                head = std::move(next);
+            }
+            if (remove) Liveness(&loop->body, head, true);
+            return head;
+        }
+        default:
+            break;
+    }
+    CollectReferences(node, &live);
+    return live;
+}
+
+void DeadCodeEliminator::RemoveUnreferenced(AST::Statements* stmts,
+                                            const Slots& referenced) {
+    auto unreferenced = [&](const AST::VarRef& ref) {
+        return !ref.IsGlobal() && !referenced.count(ref.index);
+    };
+
+    AST::Statements kept;
+    for (auto stmt : *stmts) {
+        switch (stmt->node_type) {
+            case AST::NodeType::ArrayDeclaration: {
+                auto* decl = static_cast<AST::ArrayDeclaration*>(stmt.get());
+                if (unreferenced(decl->ref)) {
+                    Remove(decl, "unused array '" + decl->name.Str() + "'");
+                    continue;
+                }
+                break;
+            }
+            case AST::NodeType::VarDef: {
+                auto* def = static_cast<AST::VarDef*>(stmt.get());
+                if (unreferenced(def->ref)) {
+                    Remove(def, "unused variable '" + def->name.Str() + "'");
+                    continue;
+                }
+                break;
+            }
+            case AST::NodeType::IfThenElse: {
+                auto* branch = static_cast<AST::IfThenElse*>(stmt.get());
+                RemoveUnreferenced(&branch->then_branch, referenced);
+                RemoveUnreferenced(&branch->else_branch, referenced);
+                break;
+            }
+            case AST::NodeType::While:
+                RemoveUnreferenced(&static_cast<AST::While*>(stmt.get())->body,
+                                   referenced);
+                break;
+            default:
+                break;
+        }
+        kept.push_back(stmt);
+    }
+    *stmts = std::move(kept);
+}
+
+void DeadCodeEliminator::Remove(const AST::ASTNode* node,
+                                std::string description) {
+    removed_.push_back({node->loc, std::move(description)});
+}
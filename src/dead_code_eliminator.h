@@ -0,0 +1,58 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "ast/ast.h"
+#include "ir.h"
+
+// Statement removed by DeadCodeEliminator.
+struct DeadCode {
+    AST::Location loc;
+    std::string description;
+};
+
+// Prints "line:col: removed <description>".
+inline std::ostream& operator<<(std::ostream& os, const DeadCode& dead) {
+    return os << dead.loc << ": removed " << dead.description;
+}
+
+// Optimization pass run after constant folding. Per function it removes
+// statements that control can never reach, stores to locals that are not
+// live afterwards and declarations of locals that are no longer
+// referenced. Only stores of literals are removed, so no side effect or
+// runtime error disappears with them.
+class DeadCodeEliminator {
+   public:
+    explicit DeadCodeEliminator(IR* ir) : ir_(ir) {}
+
+    void Run();
+
+    const std::vector<DeadCode>& Removed() const { return removed_; }
+
+   private:
+    using Slots = std::unordered_set<int>;
+
+    void EliminateFunction(AST::Function* node);
+
+    // Drops statements after one that never completes. Returns whether
+    // the block itself never completes.
+    bool RemoveUnreachable(AST::Statements* stmts);
+
+    // Backward liveness over stmts given the slots live after them;
+    // returns the slots live before them. Dead stores are removed only
+    // when remove is set, after loops have reached a fixed point.
+    Slots Liveness(AST::Statements* stmts, Slots live, bool remove);
+    Slots Liveness(AST::ASTNode* node, Slots live, bool remove);
+
+    void RemoveUnreferenced(AST::Statements* stmts, const Slots& referenced);
+
+    void Remove(const AST::ASTNode* node, std::string description);
+
+    IR* ir_;
+    std::vector<DeadCode> removed_;
+    // Statements found dead by the current liveness pass.
+    std::unordered_set<const AST::ASTNode*> dead_;
+};
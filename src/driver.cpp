@@ -1,26 +1,123 @@
 #include "driver.h"
 
 #include <iostream>
+#include <iterator>
+#include <unordered_set>
 
+#include "bounds_check_eliminator.h"
+#include "constant_folder.h"
+#include "dead_code_eliminator.h"
+#include "inliner.h"
+#include "ir_cache.h"
 #include "semantic_visitor.h"
+#include "source_file.h"
 
 int Driver::Run(std::istream& input) {
-    parser_driver_.switchInputStream(&input);
+    std::string source(std::istreambuf_iterator<char>(input), {});
+    return CompileCached(source);
+}
 
+int Driver::RunFile(const std::string& path) {
+    // Identifiers are copied into the tree, so the mapping is only needed
+    // while parsing.
+    SourceFile source(path);
+    return CompileCached(source.Text());
+}
+
+int Driver::CompileCached(std::string_view source) {
+    stats_ = Stats();
+    loaded_from_cache_ = false;
+
+    uint64_t key = 0;
+    if (!ir_cache_.empty()) {
+        key = IRCacheKey(source, inline_budget_);
+        if (auto ir = LoadIR(ir_cache_, key)) {
+            ir_ = std::move(*ir);
+            dead_code_.clear();
+            loaded_from_cache_ = true;
+            return 0;
+        }
+    }
+
+    parser_driver_.switchInputBuffer(source);
+    int res = Compile();
+    if (res == 0 && !ir_cache_.empty() && !SaveIR(ir_, key, ir_cache_)) {
+        *diagnostics_ << "Cannot write IR cache " << ir_cache_ << '\n';
+    }
+    return res;
+}
+
+int Driver::Compile() {
+    // Scanning runs inside parsing, token by token, so its cost is kept
+    // apart by the scanner and taken out of the parse afterwards.
+    parser_driver_.SetScanStats(collect_stats_ ? &stats_.scan : nullptr);
+    PhaseTimer parse_timer(&stats_.parse);
     int res = parser_driver_.parse();
+    parse_timer.Stop();
+    parser_driver_.SetScanStats(nullptr);
+    stats_.parse.Exclude(stats_.scan);
+    Checkpoint(&stats_.scan);
+    Checkpoint(&stats_.parse);
+    stats_.tokens = parser_driver_.TokenCount();
+    stats_.ast_nodes = parser_driver_.NodeCount();
     if (res) return res;
 
     ir_.SetAST(parser_driver_.GetAST());
 
-    SemanticVisitor semantic_visitor(&ir_);
+    PhaseTimer semantic_timer(&stats_.semantic);
+    SemanticVisitor semantic_visitor(&ir_, jobs_);
     try {
         ir_.GetAST()->accept(&semantic_visitor);
     } catch (const std::exception& ex) {
-        std::cout << "\033[31mError: " << ex.what() << "\033[0m\n";
+        *diagnostics_ << "\033[31mError: " << ex.what() << "\033[0m\n";
         return 1;
     }
+    semantic_timer.Stop();
+    Checkpoint(&stats_.semantic);
+    std::unordered_set<AST::Symbol> symbols;
+    for (const auto& [name, info] : ir_.GetSymbols()) symbols.insert(name);
+    for (const auto& [name, function] : ir_.GetFunctions()) {
+        symbols.insert(name);
+    }
+    stats_.symbols = symbols.size();
+    stats_.functions = ir_.FunctionCount();
+
+    PhaseTimer optimize_timer(&stats_.optimize);
+    dead_code_ = Optimize(&ir_, inline_budget_);
+    optimize_timer.Stop();
+    Checkpoint(&stats_.optimize);
 
     return 0;
 };
 
-IR Driver::GetIR() const { return ir_; }
\ No newline at end of file
+std::vector<DeadCode> Driver::Optimize(IR* ir, int inline_budget) {
+    Inliner inliner(ir, inline_budget);
+    inliner.Run();
+
+    ConstantFolder constant_folder(ir);
+    constant_folder.Run();
+
+    DeadCodeEliminator dead_code_eliminator(ir);
+    dead_code_eliminator.Run();
+
+    BoundsCheckEliminator bounds_check_eliminator(ir);
+    bounds_check_eliminator.Run();
+    return dead_code_eliminator.Removed();
+}
+
+IR Driver::GetIR() const { return ir_; }
+
+int Driver::Execute(Backend backend, OutputBuffer& out,
+                    SamplingProfiler* profiler) {
+    PhaseTimer timer(&stats_.execute);
+    int res = ::Execute(backend, ir_, out, profiler, seed_);
+    timer.Stop();
+    Checkpoint(&stats_.execute);
+    return res;
+}
+
+void Driver::Checkpoint(PhaseStats* phase) const {
+    if (collect_stats_) phase->peak_rss_kb = PeakRssKb();
+}
+
+const std::vector<DeadCode>& Driver::GetDeadCode() const { return dead_code_; }
\ No newline at end of file
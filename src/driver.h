@@ -1,17 +1,89 @@
 #pragma once
 
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "backend.h"
+#include "dead_code_eliminator.h"
+#include "inliner.h"
 #include "iostream"
 #include "ir.h"
+#include "output_buffer.h"
 #include "parser_driver.h"
+#include "stats.h"
 
 class Driver {
    public:
     int Run(std::istream& input);
+    // Compiles the file at path, scanning it out of a memory mapping.
+    // Throws std::runtime_error if the file cannot be read.
+    int RunFile(const std::string& path);
+
+    // Maximum body size of inlined functions; 0 disables inlining.
+    void SetInlineBudget(int budget) { inline_budget_ = budget; }
+
+    // Threads checking function bodies; 0 for one per hardware thread.
+    void SetJobs(size_t jobs) { jobs_ = jobs; }
+
+    // Seed of rand() in the programs executed; random when unset.
+    void SetSeed(uint64_t seed) { seed_ = seed; }
+
+    // Loads the IR from the cache file at path when it was saved for the
+    // same source and options, skipping the front end and the passes;
+    // otherwise compiles and saves it there. Nothing is reported as dead
+    // code for a cached IR.
+    void SetIRCache(const std::string& path) { ir_cache_ = path; }
+    // Stream for syntax and semantic errors; std::cout by default.
+    void SetDiagnostics(std::ostream& os) {
+        diagnostics_ = &os;
+        parser_driver_.SetDiagnostics(os);
+    }
+
+    // Whether the last run was served from the cache.
+    bool LoadedFromCache() const { return loaded_from_cache_; }
 
     IR GetIR() const;
 
+    // Runs the compiled program, adding its cost to the stats. Returns the
+    // exit code of main.
+    int Execute(Backend backend, OutputBuffer& out,
+                SamplingProfiler* profiler = nullptr);
+
+    // Measures each phase of the following runs; see GetStats.
+    void EnableStats() { collect_stats_ = true; }
+    const Stats& GetStats() const { return stats_; }
+
+    // Statements removed by dead code elimination in the last Run.
+    const std::vector<DeadCode>& GetDeadCode() const;
+
+    // Runs the optimization passes of Run on a checked IR, inlining
+    // functions up to inline_budget. Returns the dead code removed.
+    static std::vector<DeadCode> Optimize(IR* ir, int inline_budget);
+
    private:
+    // Takes source from the cache or compiles it, updating the cache.
+    int CompileCached(std::string_view source);
+    // Runs the pipeline on the input selected in parser_driver_.
+    int Compile();
+    // Records the peak RSS at the end of a phase.
+    void Checkpoint(PhaseStats* phase) const;
+
     EzAquarii::ParserDriver parser_driver_;
 
     IR ir_;
+    int inline_budget_ = Inliner::kDefaultBudget;
+    size_t jobs_ = 0;
+    std::optional<uint64_t> seed_;
+    std::vector<DeadCode> dead_code_;
+
+    std::string ir_cache_;
+    bool loaded_from_cache_ = false;
+
+    std::ostream* diagnostics_ = &std::cout;
+
+    bool collect_stats_ = false;
+    Stats stats_;
 };
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+// Contiguous stack of frame slots. Frames are bump allocated from a single
+// buffer reserved up front, so calls and block entries never allocate.
+// Slots are constructed the first time the stack grows over them and reset
+// to T{} when their frame is popped.
+template <typename T>
+class FrameStack {
+   public:
+    static constexpr size_t kDefaultCapacity = 1 << 20;
+
+    explicit FrameStack(size_t capacity = kDefaultCapacity)
+        : slots_(static_cast<T*>(::operator new(capacity * sizeof(T)))),
+          capacity_(capacity) {}
+
+    FrameStack(const FrameStack&) = delete;
+    FrameStack& operator=(const FrameStack&) = delete;
+
+    ~FrameStack() {
+        std::destroy_n(slots_, constructed_);
+        ::operator delete(slots_);
+    }
+
+    T* Push(size_t size) {
+        if (size > capacity_ - top_) throw std::runtime_error("stack overflow");
+        T* frame = slots_ + top_;
+        top_ += size;
+        if (top_ > constructed_) {
+            std::uninitialized_value_construct(slots_ + constructed_,
+                                               slots_ + top_);
+            constructed_ = top_;
+        }
+        return frame;
+    }
+
+    void Pop(size_t size) {
+        top_ -= size;
+        std::fill_n(slots_ + top_, size, T{});
+    }
+
+    size_t Size() const { return top_; }
+
+    // The buffer never moves, so pointers into it stay valid across pushes.
+    T* Data() { return slots_; }
+
+   private:
+    T* slots_;
+    size_t capacity_;
+    size_t top_ = 0;
+    size_t constructed_ = 0;
+};
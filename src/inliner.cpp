@@ -0,0 +1,522 @@
+#include "inliner.h"
+
+#include "ast/arithmetic_op.h"
+#include "ast/array.h"
+#include "ast/assign.h"
+#include "ast/bool_literal.h"
+#include "ast/fun_call.h"
+#include "ast/function.h"
+#include "ast/if_then_else.h"
+#include "ast/integer.h"
+#include "ast/logic_op.h"
+#include "ast/print.h"
+#include "ast/program.h"
+#include "ast/rand.h"
+#include "ast/return.h"
+#include "ast/string_literal.h"
+#include "ast/var.h"
+#include "ast/while.h"
+
+namespace {
+
+// Whether a function body may be copied into another frame: no calls, no
+// arrays and no return inside a loop, which cannot be lowered to a store
+// without a break statement.
+bool CanInline(const AST::ASTNode* node, bool in_loop) {
+    auto all = [](const AST::Statements& stmts, bool in_loop) {
+        for (auto stmt : stmts) {
+            if (!CanInline(stmt.get(), in_loop)) return false;
+        }
+        return true;
+    };
+
+    switch (node->node_type) {
+        case AST::NodeType::ArrayAccess:
+        case AST::NodeType::ArrayAssignment:
+        case AST::NodeType::ArrayDeclaration:
+        case AST::NodeType::FunCall:
+            return false;
+        case AST::NodeType::ArithOp: {
+            auto* op = static_cast<const AST::ArithOp*>(node);
+            return CanInline(op->lhs.get(), in_loop) &&
+                   CanInline(op->rhs.get(), in_loop);
+        }
+        case AST::NodeType::Assign:
+            return CanInline(static_cast<const AST::Assign*>(node)->expr.get(),
+                             in_loop);
+        case AST::NodeType::IfThenElse: {
+            auto* branch = static_cast<const AST::IfThenElse*>(node);
+            return CanInline(branch->condition.get(), in_loop) &&
+                   all(branch->then_branch, in_loop) &&
+                   all(branch->else_branch, in_loop);
+        }
+        case AST::NodeType::LogicOp: {
+            auto* op = static_cast<const AST::LogicOp*>(node);
+            return CanInline(op->lhs.get(), in_loop) &&
+                   CanInline(op->rhs.get(), in_loop);
+        }
+        case AST::NodeType::Print:
+            return CanInline(static_cast<const AST::Print*>(node)->expr.get(),
+                             in_loop);
+        case AST::NodeType::Return: {
+            auto* ret = static_cast<const AST::Return*>(node);
+            return !in_loop &&
+                   (!ret->expr || CanInline(ret->expr.get(), false));
+        }
+        case AST::NodeType::Var:
+            return !static_cast<const AST::Var*>(node)->type.is_array;
+        case AST::NodeType::While: {
+            auto* loop = static_cast<const AST::While*>(node);
+            return CanInline(loop->condition.get(), true) &&
+                   all(loop->body, true);
+        }
+        default:
+            return true;
+    }
+}
+
+bool AlwaysReturns(const AST::Statements& stmts) {
+    for (auto stmt : stmts) {
+        if (stmt->node_type == AST::NodeType::Return) return true;
+        if (stmt->node_type == AST::NodeType::IfThenElse) {
+            auto* branch = static_cast<const AST::IfThenElse*>(stmt.get());
+            if (AlwaysReturns(branch->then_branch) &&
+                AlwaysReturns(branch->else_branch)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool ContainsReturn(const AST::Statements& stmts) {
+    for (auto stmt : stmts) {
+        if (stmt->node_type == AST::NodeType::Return) return true;
+        if (stmt->node_type == AST::NodeType::IfThenElse) {
+            auto* branch = static_cast<const AST::IfThenElse*>(stmt.get());
+            if (ContainsReturn(branch->then_branch) ||
+                ContainsReturn(branch->else_branch)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+int CountNodes(const AST::ASTNode* node) {
+    auto all = [](const AST::Statements& stmts) {
+        int count = 0;
+        for (auto stmt : stmts) count += CountNodes(stmt.get());
+        return count;
+    };
+
+    switch (node->node_type) {
+        case AST::NodeType::ArithOp: {
+            auto* op = static_cast<const AST::ArithOp*>(node);
+            return 1 + CountNodes(op->lhs.get()) + CountNodes(op->rhs.get());
+        }
+        case AST::NodeType::Assign: {
+            auto* assign = static_cast<const AST::Assign*>(node);
+            return 1 + CountNodes(assign->expr.get());
+        }
+        case AST::NodeType::IfThenElse: {
+            auto* branch = static_cast<const AST::IfThenElse*>(node);
+            return 1 + CountNodes(branch->condition.get()) +
+                   all(branch->then_branch) + all(branch->else_branch);
+        }
+        case AST::NodeType::LogicOp: {
+            auto* op = static_cast<const AST::LogicOp*>(node);
+            return 1 + CountNodes(op->lhs.get()) + CountNodes(op->rhs.get());
+        }
+        case AST::NodeType::Print: {
+            auto* print = static_cast<const AST::Print*>(node);
+            return 1 + CountNodes(print->expr.get());
+        }
+        case AST::NodeType::While: {
+            auto* loop = static_cast<const AST::While*>(node);
+            return 1 + CountNodes(loop->condition.get()) + all(loop->body);
+        }
+        default:
+            return 1;
+    }
+}
+
+bool IsLiteral(const AST::ASTNode* node) {
+    return node->node_type == AST::NodeType::Integer ||
+           node->node_type == AST::NodeType::BoolLiteral ||
+           node->node_type == AST::NodeType::StringLiteral;
+}
+
+std::shared_ptr<AST::Var> MakeVar(const AST::VarRef& ref, AST::Symbol name,
+                                  AST::Type type, AST::Location loc) {
+    auto var = std::make_shared<AST::Var>();
+    var->name = name;
+    var->ref = ref;
+    var->type = type;
+    var->loc = loc;
+    return var;
+}
+
+std::shared_ptr<AST::Assign> MakeAssign(const AST::VarRef& ref,
+                                        AST::Symbol name,
+                                        std::shared_ptr<AST::Expr> expr,
+                                        AST::Location loc) {
+    auto assign = std::make_shared<AST::Assign>();
+    assign->var = name;
+    assign->ref = ref;
+    assign->expr = expr;
+    assign->loc = loc;
+    return assign;
+}
+
+}  // namespace
+
+void Inliner::Run() {
+    if (budget_ <= 0) return;
+
+    auto* program = static_cast<AST::Program*>(ir_->GetAST().get());
+    for (auto global : program->globals) {
+        if (global->node_type == AST::NodeType::Function) {
+            caller_ = static_cast<AST::Function*>(global.get());
+            InlineBlock(&caller_->body);
+        }
+    }
+}
+
+bool Inliner::IsInlinable(AST::Function* callee) {
+    auto iter = inlinable_.find(callee);
+    if (iter != inlinable_.end()) return iter->second;
+
+    bool inlinable = !callee->return_type.is_array;
+    for (const auto& arg : callee->args) {
+        inlinable = inlinable && !arg.type.is_array;
+    }
+    for (auto stmt : callee->body) {
+        inlinable = inlinable && CanInline(stmt.get(), false);
+    }
+    if (callee->return_type.base != AST::BaseType::Void) {
+        inlinable = inlinable && AlwaysReturns(callee->body);
+    }
+    int size = 0;
+    for (auto stmt : callee->body) size += CountNodes(stmt.get());
+    // Lowering may copy statements following an if, so the lowered body is
+    // checked against the budget as well.
+    if (inlinable && size <= budget_) {
+        base_ = 0;
+        result_ = {AST::VarRef::Scope::Local, callee->frame_size};
+        AST::Statements lowered;
+        Lower(callee->body, 0, &lowered);
+        size = 0;
+        for (auto stmt : lowered) size += CountNodes(stmt.get());
+    }
+    inlinable = inlinable && size <= budget_;
+
+    inlinable_[callee] = inlinable;
+    return inlinable;
+}
+
+bool Inliner::IsInlinableCall(const AST::FunCall* call) {
+    auto* callee = call->target;
+    return callee->return_type.base != AST::BaseType::Void &&
+           IsInlinable(callee);
+}
+
+bool Inliner::ContainsInlinable(const AST::ASTNode* node) {
+    switch (node->node_type) {
+        case AST::NodeType::ArithOp: {
+            auto* op = static_cast<const AST::ArithOp*>(node);
+            return ContainsInlinable(op->lhs.get()) ||
+                   ContainsInlinable(op->rhs.get());
+        }
+        case AST::NodeType::ArrayAccess:
+            return ContainsInlinable(
+                static_cast<const AST::ArrayAccess*>(node)->index.get());
+        case AST::NodeType::FunCall: {
+            auto* call = static_cast<const AST::FunCall*>(node);
+            if (IsInlinableCall(call)) return true;
+            for (auto arg : call->args) {
+                if (ContainsInlinable(arg.get())) return true;
+            }
+            return false;
+        }
+        case AST::NodeType::LogicOp: {
+            auto* op = static_cast<const AST::LogicOp*>(node);
+            return ContainsInlinable(op->lhs.get()) ||
+                   ContainsInlinable(op->rhs.get());
+        }
+        default:
+            return false;
+    }
+}
+
+void Inliner::InlineBlock(AST::Statements* stmts) {
+    AST::Statements inlined;
+    for (auto stmt : *stmts) {
+        InlineStmt(stmt, &inlined);
+    }
+    *stmts = std::move(inlined);
+}
+
+void Inliner::InlineStmt(std::shared_ptr<AST::ASTNode> node,
+                         AST::Statements* out) {
+    switch (node->node_type) {
+        case AST::NodeType::ArrayAssignment: {
+            // The index is evaluated before the stored value.
+            auto* assign = static_cast<AST::ArrayAssignment*>(node.get());
+            if (ContainsInlinable(assign->expr.get())) {
+                Hoist(assign->index, out);
+                Spill(assign->index, out);
+                Hoist(assign->expr, out);
+            } else {
+                Hoist(assign->index, out);
+            }
+            break;
+        }
+        case AST::NodeType::Assign:
+            Hoist(static_cast<AST::Assign*>(node.get())->expr, out);
+            break;
+        case AST::NodeType::IfThenElse: {
+            auto* branch = static_cast<AST::IfThenElse*>(node.get());
+            Hoist(branch->condition, out);
+            InlineBlock(&branch->then_branch);
+            InlineBlock(&branch->else_branch);
+            break;
+        }
+        case AST::NodeType::Print:
+            Hoist(static_cast<AST::Print*>(node.get())->expr, out);
+            break;
+        case AST::NodeType::Return: {
+            auto* ret = static_cast<AST::Return*>(node.get());
+            if (ret->expr) Hoist(ret->expr, out);
+            break;
+        }
+        case AST::NodeType::While:
+            InlineBlock(&static_cast<AST::While*>(node.get())->body);
+            break;
+        case AST::NodeType::ArrayDeclaration:
+        case AST::NodeType::VarDef:
+            break;
+        default:
+            if (node->node_type == AST::NodeType::FunCall) {
+                // The result of a call used as a statement is discarded,
+                // so void callees can be inlined here as well.
+                auto* call = static_cast<AST::FunCall*>(node.get());
+                HoistArgs(call, out);
+                if (IsInlinable(call->target)) {
+                    Expand(call, out);
+                    return;
+                }
+                break;
+            }
+            Hoist(node, out);
+    }
+    out->push_back(node);
+}
+
+std::shared_ptr<AST::ASTNode> Inliner::HoistNode(
+    std::shared_ptr<AST::ASTNode> node, AST::Statements* pre) {
+    if (!ContainsInlinable(node.get())) return node;
+
+    switch (node->node_type) {
+        case AST::NodeType::ArithOp: {
+            auto* op = static_cast<AST::ArithOp*>(node.get());
+            Hoist(op->lhs, pre);
+            if (ContainsInlinable(op->rhs.get())) {
+                Spill(op->lhs, pre);
+                Hoist(op->rhs, pre);
+            }
+            return node;
+        }
+        case AST::NodeType::ArrayAccess:
+            Hoist(static_cast<AST::ArrayAccess*>(node.get())->index, pre);
+            return node;
+        case AST::NodeType::FunCall: {
+            auto* call = static_cast<AST::FunCall*>(node.get());
+            HoistArgs(call, pre);
+            if (!IsInlinableCall(call)) return node;
+            return Expand(call, pre);
+        }
+        case AST::NodeType::LogicOp: {
+            auto* op = static_cast<AST::LogicOp*>(node.get());
+            Hoist(op->lhs, pre);
+            if (ContainsInlinable(op->rhs.get())) {
+                Spill(op->lhs, pre);
+                Hoist(op->rhs, pre);
+            }
+            return node;
+        }
+        default:
+            return node;
+    }
+}
+
+void Inliner::HoistArgs(AST::FunCall* call, AST::Statements* pre) {
+    int last = -1;
+    for (size_t i = 0; i < call->args.size(); ++i) {
+        if (ContainsInlinable(call->args[i].get())) last = i;
+    }
+    for (int i = 0; i < last; ++i) {
+        Hoist(call->args[i], pre);
+        Spill(call->args[i], pre);
+    }
+    if (last >= 0) Hoist(call->args[last], pre);
+}
+
+std::shared_ptr<AST::ASTNode> Inliner::SpillNode(
+    std::shared_ptr<AST::ASTNode> node, AST::Statements* pre) {
+    auto expr = std::static_pointer_cast<AST::Expr>(node);
+    if (IsLiteral(expr.get()) || expr->type.is_array) return node;
+
+    auto temp = NewSlot();
+    AST::Symbol name("$tmp");
+    pre->push_back(MakeAssign(temp, name, expr, expr->loc));
+    return MakeVar(temp, name, expr->type, expr->loc);
+}
+
+std::shared_ptr<AST::Expr> Inliner::Expand(AST::FunCall* call,
+                                           AST::Statements* pre) {
+    auto* callee = call->target;
+    ++inlined_count_;
+
+    base_ = caller_->frame_size;
+    caller_->frame_size += callee->frame_size;
+    for (size_t i = 0; i < call->args.size(); ++i) {
+        AST::VarRef param{AST::VarRef::Scope::Local,
+                          base_ + static_cast<int>(i)};
+        pre->push_back(MakeAssign(param, callee->args[i].name, call->args[i],
+                                  call->loc));
+    }
+
+    if (callee->return_type.base == AST::BaseType::Void) {
+        result_ = {};
+        Lower(callee->body, 0, pre);
+        return nullptr;
+    }
+    result_ = NewSlot();
+    AST::Symbol name("$" + callee->name.Str());
+    Lower(callee->body, 0, pre);
+    return MakeVar(result_, name, callee->return_type, call->loc);
+}
+
+void Inliner::Lower(const AST::Statements& stmts, size_t from,
+                    AST::Statements* out) {
+    for (size_t i = from; i < stmts.size(); ++i) {
+        auto* stmt = stmts[i].get();
+        if (stmt->node_type == AST::NodeType::Return) {
+            auto* ret = static_cast<AST::Return*>(stmt);
+            if (ret->expr && result_.scope != AST::VarRef::Scope::Unresolved) {
+                out->push_back(MakeAssign(result_, AST::Symbol("$result"),
+                                          Clone(ret->expr), ret->loc));
+            }
+            return;
+        }
+        if (stmt->node_type == AST::NodeType::IfThenElse) {
+            auto* branch = static_cast<AST::IfThenElse*>(stmt);
+            if (ContainsReturn(branch->then_branch) ||
+                ContainsReturn(branch->else_branch)) {
+                auto copy = std::make_shared<AST::IfThenElse>();
+                copy->loc = branch->loc;
+                copy->condition = Clone(branch->condition);
+
+                auto then_rest = branch->then_branch;
+                auto else_rest = branch->else_branch;
+                then_rest.insert(then_rest.end(), stmts.begin() + i + 1,
+                                 stmts.end());
+                else_rest.insert(else_rest.end(), stmts.begin() + i + 1,
+                                 stmts.end());
+                Lower(then_rest, 0, &copy->then_branch);
+                Lower(else_rest, 0, &copy->else_branch);
+                out->push_back(copy);
+                return;
+            }
+        }
+        out->push_back(Clone(stmt));
+    }
+}
+
+std::shared_ptr<AST::ASTNode> Inliner::Clone(const AST::ASTNode* node) {
+    auto move = [this](AST::VarRef ref) {
+        if (!ref.IsGlobal()) ref.index += base_;
+        return ref;
+    };
+    auto clone_all = [this](const AST::Statements& stmts) {
+        AST::Statements copies;
+        for (auto stmt : stmts) copies.push_back(Clone(stmt.get()));
+        return copies;
+    };
+
+    switch (node->node_type) {
+        case AST::NodeType::ArithOp: {
+            auto copy = std::make_shared<AST::ArithOp>(
+                *static_cast<const AST::ArithOp*>(node));
+            copy->lhs = Clone(copy->lhs);
+            copy->rhs = Clone(copy->rhs);
+            return copy;
+        }
+        case AST::NodeType::Assign: {
+            auto copy = std::make_shared<AST::Assign>(
+                *static_cast<const AST::Assign*>(node));
+            copy->ref = move(copy->ref);
+            copy->expr = Clone(copy->expr);
+            return copy;
+        }
+        case AST::NodeType::BoolLiteral:
+            return std::make_shared<AST::BoolLiteral>(
+                *static_cast<const AST::BoolLiteral*>(node));
+        case AST::NodeType::IfThenElse: {
+            auto copy = std::make_shared<AST::IfThenElse>(
+                *static_cast<const AST::IfThenElse*>(node));
+            copy->condition = Clone(copy->condition);
+            copy->then_branch = clone_all(copy->then_branch);
+            copy->else_branch = clone_all(copy->else_branch);
+            return copy;
+        }
+        case AST::NodeType::Integer:
+            return std::make_shared<AST::Integer>(
+                *static_cast<const AST::Integer*>(node));
+        case AST::NodeType::LogicOp: {
+            auto copy = std::make_shared<AST::LogicOp>(
+                *static_cast<const AST::LogicOp*>(node));
+            copy->lhs = Clone(copy->lhs);
+            copy->rhs = Clone(copy->rhs);
+            return copy;
+        }
+        case AST::NodeType::Print: {
+            auto copy = std::make_shared<AST::Print>(
+                *static_cast<const AST::Print*>(node));
+            copy->expr = Clone(copy->expr);
+            return copy;
+        }
+        case AST::NodeType::Rand:
+            return std::make_shared<AST::Rand>(
+                *static_cast<const AST::Rand*>(node));
+        case AST::NodeType::StringLiteral:
+            return std::make_shared<AST::StringLiteral>(
+                *static_cast<const AST::StringLiteral*>(node));
+        case AST::NodeType::Var: {
+            auto copy =
+                std::make_shared<AST::Var>(*static_cast<const AST::Var*>(node));
+            copy->ref = move(copy->ref);
+            return copy;
+        }
+        case AST::NodeType::VarDef: {
+            auto copy = std::make_shared<AST::VarDef>(
+                *static_cast<const AST::VarDef*>(node));
+            copy->ref = move(copy->ref);
+            return copy;
+        }
+        case AST::NodeType::While: {
+            auto copy = std::make_shared<AST::While>(
+                *static_cast<const AST::While*>(node));
+            copy->condition = Clone(copy->condition);
+            copy->body = clone_all(copy->body);
+            return copy;
+        }
+        default:
+            throw std::runtime_error("Inliner: unexpected node");
+    }
+}
+
+AST::VarRef Inliner::NewSlot() {
+    return {AST::VarRef::Scope::Local, caller_->frame_size++};
+}
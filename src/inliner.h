@@ -0,0 +1,102 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+
+#include "ast/ast.h"
+#include "ast/expr.h"
+#include "ast/fun_call.h"
+#include "ast/var_ref.h"
+#include "ir.h"
+
+// Optimization pass run after semantic analysis that replaces calls to
+// small leaf functions by a copy of their body. The callee's slots are
+// appended to the caller's frame, arguments are assigned to the copied
+// parameter slots and every return stores to a result slot read in place
+// of the call. Since variables are already resolved to slots, names in
+// the callee never clash with or shadow names in the caller.
+//
+// Calls are hoisted out of their statement; operands evaluated before the
+// call are spilled to temporaries first so evaluation order is kept.
+// Calls in while conditions stay, since they are evaluated per iteration.
+class Inliner {
+   public:
+    // Maximum number of AST nodes in the copied body of a callee.
+    static constexpr int kDefaultBudget = 40;
+
+    explicit Inliner(IR* ir, int budget = kDefaultBudget)
+        : ir_(ir), budget_(budget) {}
+
+    void Run();
+
+    // Number of call sites replaced.
+    int InlinedCount() const { return inlined_count_; }
+
+   private:
+    // A callee is inlined when it is a leaf without arrays, returns only
+    // outside loops, returns on every path unless it is void, and its
+    // lowered body fits in the budget.
+    bool IsInlinable(AST::Function* callee);
+    // Calls in expressions need a value, so void callees are only inlined
+    // when called as a statement.
+    bool IsInlinableCall(const AST::FunCall* call);
+    bool ContainsInlinable(const AST::ASTNode* node);
+
+    void InlineBlock(AST::Statements* stmts);
+    void InlineStmt(std::shared_ptr<AST::ASTNode> node, AST::Statements* out);
+
+    // Inlines the calls in node, appending their bodies to pre, and
+    // returns the expression to evaluate after pre.
+    std::shared_ptr<AST::ASTNode> HoistNode(
+        std::shared_ptr<AST::ASTNode> node, AST::Statements* pre);
+    // Hoists the arguments of call, spilling the ones evaluated before the
+    // last argument with an inlinable call.
+    void HoistArgs(AST::FunCall* call, AST::Statements* pre);
+    // Evaluates node into a temporary unless it is a literal or an array.
+    std::shared_ptr<AST::ASTNode> SpillNode(
+        std::shared_ptr<AST::ASTNode> node, AST::Statements* pre);
+    // Appends the body of the call to pre; returns the result variable,
+    // or nullptr for a void callee.
+    std::shared_ptr<AST::Expr> Expand(AST::FunCall* call,
+                                      AST::Statements* pre);
+
+    // Replace node in place by the result of HoistNode and SpillNode.
+    template <typename T>
+    void Hoist(std::shared_ptr<T>& node, AST::Statements* pre) {
+        node = std::static_pointer_cast<T>(
+            HoistNode(std::static_pointer_cast<AST::ASTNode>(node), pre));
+    }
+    template <typename T>
+    void Spill(std::shared_ptr<T>& node, AST::Statements* pre) {
+        node = std::static_pointer_cast<T>(
+            SpillNode(std::static_pointer_cast<AST::ASTNode>(node), pre));
+    }
+
+    // Copies stmts[from..] replacing returns by stores to result_. A
+    // statement after an if containing a return is copied into both of
+    // its branches.
+    void Lower(const AST::Statements& stmts, size_t from,
+               AST::Statements* out);
+    // Deep copy of a statement or expression without returns, with local
+    // slots moved by base_.
+    std::shared_ptr<AST::ASTNode> Clone(const AST::ASTNode* node);
+    template <typename T>
+    std::shared_ptr<T> Clone(const std::shared_ptr<T>& node) {
+        return std::static_pointer_cast<T>(Clone(node.get()));
+    }
+
+    // Adds a slot to the caller's frame.
+    AST::VarRef NewSlot();
+
+    IR* ir_;
+    int budget_;
+    int inlined_count_ = 0;
+
+    std::unordered_map<const AST::Function*, bool> inlinable_;
+    AST::Function* caller_ = nullptr;
+
+    // Frame offset of the callee's slots and its result slot while
+    // lowering a body.
+    int base_ = 0;
+    AST::VarRef result_;
+};
@@ -1,8 +1,8 @@
 #include "interpreter.h"
 
 #include <algorithm>
-#include <random>
 #include <string>
+#include <utility>
 
 #include "ast/arithmetic_op.h"
 #include "ast/array.h"
@@ -23,202 +23,244 @@
 #include "ir.h"
 
 int Interpreter::Exec() {
-    auto obj = Eval(static_cast<AST::Program*>(ir_.GetAST().get()));
+    auto value = Eval(static_cast<AST::Program*>(ir_.GetAST().get()));
 
-    auto number_ptr = obj.TryAs<Number>();
-    if (number_ptr) return number_ptr->GetValue();
+    if (value.IsInt()) return value.AsInt();
 
     return 1;
 }
 
-ObjectHolder Interpreter::Eval(AST::ArithOp* node) {
-    auto lhs = Eval(node->lhs.get());
-    auto rhs = Eval(node->rhs.get());
-
-    if (node->op == "+") {
-        return ObjectHolder::Own(ValueObject(lhs.TryAs<Number>()->GetValue() +
-                                             rhs.TryAs<Number>()->GetValue()));
-    } else if (node->op == "-") {
-        return ObjectHolder::Own(ValueObject(lhs.TryAs<Number>()->GetValue() -
-                                             rhs.TryAs<Number>()->GetValue()));
-    } else if (node->op == "*") {
-        return ObjectHolder::Own(ValueObject(lhs.TryAs<Number>()->GetValue() *
-                                             rhs.TryAs<Number>()->GetValue()));
-    } else if (node->op == "/") {
-        auto r_val = rhs.TryAs<Number>()->GetValue();
-        if (r_val == 0) {
-            Error(node, "division by zero");
-        }
-        return ObjectHolder::Own(
-            ValueObject(lhs.TryAs<Number>()->GetValue() / r_val));
-    } else if (node->op == "%") {
-        return ObjectHolder::Own(ValueObject(lhs.TryAs<Number>()->GetValue() %
-                                             rhs.TryAs<Number>()->GetValue()));
-    } else {
-        Error(node, "Unknown arith op: ", node->op);
+Value Interpreter::Eval(AST::ArithOp* node) {
+    auto lhs = Eval(node->lhs.get()).AsInt();
+    auto rhs = Eval(node->rhs.get()).AsInt();
+
+    switch (node->op) {
+        case AST::Operator::Add:
+            return Value::Int(lhs + rhs);
+        case AST::Operator::Sub:
+            return Value::Int(lhs - rhs);
+        case AST::Operator::Mul:
+            return Value::Int(lhs * rhs);
+        case AST::Operator::Div:
+            if (rhs == 0) {
+                Error(node, "division by zero");
+            }
+            return Value::Int(lhs / rhs);
+        case AST::Operator::Mod:
+            if (rhs == 0) {
+                Error(node, "division by zero");
+            }
+            return Value::Int(lhs % rhs);
+        default:
+            Error(node, "Unknown arith op: ", node->op);
     }
-    return ObjectHolder::None();
+    return Value::None();
 }
 
-ObjectHolder Interpreter::Eval(AST::ArrayAccess* node) {
-    auto index_obj = Eval(node->index.get());
-    auto index_ptr = index_obj.TryAs<Number>();
-    if (!index_ptr) {
+Value Interpreter::Eval(AST::ArrayAccess* node) {
+    auto index = Eval(node->index.get());
+    if (!index.IsInt()) {
         Error(node, "Index expr is not int");
     }
-    auto* var = call_stack.Find(node->name);
-    if (!var) {
-        Error(node, "Variable ", node->name, " undefined");
-    }
-    auto arr_obj = var->TryAs<ArrayObject>();
-    if (!arr_obj) {
+    auto& var = Slot(node->ref);
+    if (!var.IsArray()) {
         Error(node, "Not array object");
     }
+    auto* arr_obj = var.AsArray();
+    if (!node->check_bounds) {
+        return Value::Int(arr_obj->LoadUnchecked(index.AsInt()));
+    }
     try {
-        return arr_obj->GetObject(index_ptr->GetValue());
+        return Value::Int(arr_obj->Load(index.AsInt()));
     } catch (std::exception& ex) {
         Error(node, ex.what());
     }
-    return ObjectHolder::None();
+    return Value::None();
 }
 
-ObjectHolder Interpreter::Eval(AST::ArrayDeclaration* node) {
-    call_stack.Declare(node->name, ObjectHolder::Own(ArrayObject()));
-    return *call_stack.Find(node->name);
+Value Interpreter::Eval(AST::ArrayDeclaration* node) {
+    Slot(node->ref) = Value::NewArray(node->type.array_size);
+    return Value::None();
 }
 
-ObjectHolder Interpreter::Eval(AST::ArrayAssignment* node) {
-    auto index_obj = Eval(node->index.get());
-    auto index_ptr = index_obj.TryAs<Number>();
-    if (!index_ptr) {
+Value Interpreter::Eval(AST::ArrayAssignment* node) {
+    auto index = Eval(node->index.get());
+    if (!index.IsInt()) {
         Error(node, "Index expr is not int");
     }
-    auto* var = call_stack.Find(node->name);
-    if (!var) {
-        Error(node, "Variable ", node->name, " undefined");
-    }
-    auto arr_obj = var->TryAs<ArrayObject>();
-    if (!arr_obj) {
+    auto value = Eval(node->expr.get());
+    auto& var = Slot(node->ref);
+    if (!var.IsArray()) {
         Error(node, "Not array object");
     }
-    arr_obj->SetObject(index_ptr->GetValue(), Eval(node->expr.get()));
-    return *call_stack.Find(node->name);
-}
-
-ObjectHolder Interpreter::Eval(AST::Assign* node) {
-    auto* obj = call_stack.Find(node->var);
-    if (!obj) {
-        Error(node, "Variable ", node->var, " undefined");
+    auto* arr_obj = var.AsArray();
+    if (!node->check_bounds) {
+        arr_obj->StoreUnchecked(index.AsInt(), value.AsInt());
+        return Value::None();
     }
+    try {
+        arr_obj->Store(index.AsInt(), value.AsInt());
+    } catch (std::exception& ex) {
+        Error(node, ex.what());
+    }
+    return Value::None();
+}
 
+Value Interpreter::Eval(AST::Assign* node) {
     auto val = Eval(node->expr.get());
     if (!val) {
         Error(node, "Assign expr returned None");
     }
 
-    *obj = val;
+    auto& slot = Slot(node->ref);
+    slot = std::move(val);
 
-    return *obj;
+    return slot;
 }
 
-ObjectHolder Interpreter::Eval(AST::BoolLiteral* node) {
-    return ObjectHolder::Own(ValueObject(node->value));
+Value Interpreter::Eval(AST::BoolLiteral* node) {
+    return Value::Bool(node->value);
 }
 
-ObjectHolder Interpreter::Eval(AST::FunCall* node) {
-    std::vector<ObjectHolder> args;
+Value Interpreter::Eval(AST::FunCall* node) {
+    auto* func = node->target;
+
+    // Arguments are evaluated straight into the parameter slots of the
+    // callee frame; nested calls push their frames above it.
+    Value* frame = stack_.Push(func->frame_size);
     for (size_t i = 0; i < node->args.size(); ++i) {
-        args.push_back(Eval(node->args[i].get()));
+        frame[i] = Eval(node->args[i].get());
     }
 
-    return Eval(ir_.GetFunction(node->name).get(), args);
+    return Eval(func, frame);
 }
 
-ObjectHolder Interpreter::Eval(AST::Function* node,
-                               std::vector<ObjectHolder> args) {
-    call_stack.PushScope();
-    for (size_t i = 0; i < node->args.size(); ++i) {
-        call_stack.Declare(node->args[i].name, args[i]);
+Value Interpreter::Eval(AST::Function* node, Value* frame) {
+    if (profiler_) profiler_->Enter(node);
+    Profile* profile = Tier(node);
+    if (profile && profile->code) {
+        auto result = CallNative(node, *profile->code, frame);
+        if (profiler_) profiler_->Leave();
+        return result;
     }
-    ObjectHolder return_copy;
-    for (auto stmt : node->body) {
-        Eval(stmt.get());
-        if (return_result) {
-            return_copy = *return_result;
-            return_result.release();
-            break;
-        }
+
+    Value* caller_frame = std::exchange(frame_, frame);
+    Profile* caller_profile = std::exchange(profile_, profile);
+
+    Value result;
+    if (Exec(node->body) == Completion::Return) {
+        result = std::move(return_value_);
+    }
+    frame_ = caller_frame;
+    profile_ = caller_profile;
+    stack_.Pop(node->frame_size);
+    if (profiler_) profiler_->Leave();
+    return result;
+}
+
+Interpreter::Profile* Interpreter::Tier(AST::Function* node) {
+    if (jit_threshold_ < 0) return nullptr;
+
+    auto& profile = profiles_[node];
+    if (profile.code || profile.rejected) return &profile;
+    if (profile.counter++ < jit_threshold_) return &profile;
+
+    if (!jit_) jit_ = std::make_unique<JitCompiler>(globals_.data());
+    profile.code = jit_->Compile(node);
+    profile.rejected = !profile.code;
+    return &profile;
+}
+
+Value Interpreter::CallNative(AST::Function* node, const JitFunction& code,
+                              Value* frame) {
+    JitError error;
+    int64_t result = code.Call(frame, &error);
+    stack_.Pop(node->frame_size);
+    if (result < 0) {
+        Error(const_cast<AST::ASTNode*>(error.node), error.message);
+    }
+
+    switch (node->return_type.base) {
+        case AST::BaseType::Int:
+            return Value::Int(static_cast<int32_t>(result));
+        case AST::BaseType::Bool:
+            return Value::Bool(result != 0);
+        default:
+            return Value::None();
+    }
+}
+
+int Interpreter::JitCompiledCount() const {
+    int count = 0;
+    for (const auto& [func, profile] : profiles_) {
+        if (profile.code) ++count;
     }
-    call_stack.PopScope();
-    return return_copy;
+    return count;
 }
 
-ObjectHolder Interpreter::Eval(AST::IfThenElse* node) {
+Interpreter::Completion Interpreter::Exec(AST::ASTNode* node) {
+    switch (node->node_type) {
+        case AST::NodeType::IfThenElse:
+            return Exec(static_cast<AST::IfThenElse*>(node));
+        case AST::NodeType::Return:
+            return Exec(static_cast<AST::Return*>(node));
+        case AST::NodeType::While:
+            return Exec(static_cast<AST::While*>(node));
+        default:
+            Eval(node);
+            return Completion::Normal;
+    }
+}
+
+Interpreter::Completion Interpreter::Exec(const AST::Statements& stmts) {
+    for (const auto& stmt : stmts) {
+        if (Exec(stmt.get()) == Completion::Return) return Completion::Return;
+    }
+    return Completion::Normal;
+}
+
+Interpreter::Completion Interpreter::Exec(AST::IfThenElse* node) {
     auto cond = Eval(node->condition.get());
-    auto cond_bool = cond.TryAs<Bool>();
-    if (!cond_bool) {
+    if (!cond.IsBool()) {
         Error(node, "If condition is not bool");
     }
-    if (cond.TryAs<Bool>()->GetValue()) {
-        call_stack.PushScope();
-        for (auto stmt : node->then_branch) {
-            Eval(stmt.get());
-            if (return_result) {
-                break;
-            }
-        }
-        call_stack.PopScope();
-        return ObjectHolder::None();
-    } else if (!node->else_branch.empty()) {
-        call_stack.PushScope();
-        for (auto stmt : node->else_branch) {
-            Eval(stmt.get());
-            if (return_result) {
-                break;
-            }
-        }
-        call_stack.PopScope();
-        return ObjectHolder::None();
-    }
-    return ObjectHolder::None();
+    return Exec(cond.AsBool() ? node->then_branch : node->else_branch);
 }
 
-ObjectHolder Interpreter::Eval(AST::Integer* node) {
-    return ObjectHolder::Own(ValueObject(node->value));
+Value Interpreter::Eval(AST::Integer* node) {
+    return Value::Int(node->value);
 }
 
-ObjectHolder Interpreter::Eval(AST::LogicOp* node) {
-    auto lhs = Eval(node->lhs.get());
-    auto rhs = Eval(node->rhs.get());
-
-    if (node->op == "<") {
-        return ObjectHolder::Own(ValueObject(lhs.TryAs<Number>()->GetValue() <
-                                             rhs.TryAs<Number>()->GetValue()));
-    } else if (node->op == ">") {
-        return ObjectHolder::Own(ValueObject(lhs.TryAs<Number>()->GetValue() >
-                                             rhs.TryAs<Number>()->GetValue()));
-    } else if (node->op == "==") {
-        return ObjectHolder::Own(ValueObject(lhs.TryAs<Number>()->GetValue() ==
-                                             rhs.TryAs<Number>()->GetValue()));
-    } else {
-        Error(node, "Unknown logic op: ", node->op);
+Value Interpreter::Eval(AST::LogicOp* node) {
+    auto lhs = Eval(node->lhs.get()).Payload();
+    auto rhs = Eval(node->rhs.get()).Payload();
+
+    switch (node->op) {
+        case AST::Operator::Less:
+            return Value::Bool(lhs < rhs);
+        case AST::Operator::Greater:
+            return Value::Bool(lhs > rhs);
+        case AST::Operator::Equal:
+            return Value::Bool(lhs == rhs);
+        default:
+            Error(node, "Unknown logic op: ", node->op);
     }
-    return ObjectHolder::None();
+    return Value::None();
 }
 
-ObjectHolder Interpreter::Eval(AST::Print* node) {
-    auto obj_holder = Eval(node->expr.get());
-    if (obj_holder) obj_holder->Print(os_);
-    return ObjectHolder::None();
+Value Interpreter::Eval(AST::Print* node) {
+    Eval(node->expr.get()).Print(out_);
+    return Value::None();
 }
 
-ObjectHolder Interpreter::Eval(AST::Program* node) {
+Value Interpreter::Eval(AST::Program* node) {
     AST::Function* main_func = nullptr;
+    globals_.assign(ir_.GetGlobalCount(), Value::None());
 
     for (auto global : node->globals) {
         auto func = std::dynamic_pointer_cast<AST::Function>(global);
         if (func) {
-            if (func->name == "main") main_func = func.get();
+            if (func->name == AST::Symbol("main")) main_func = func.get();
         } else {
             Eval(global.get());
         }
@@ -228,66 +270,53 @@ ObjectHolder Interpreter::Eval(AST::Program* node) {
         Error(node, "main function undefined");
     }
 
-    return Eval(main_func);
+    return Eval(main_func, stack_.Push(main_func->frame_size));
 }
 
-ObjectHolder Interpreter::Eval(AST::Rand* node) {
-    static std::mt19937 rng(std::random_device{}());
-    static std::uniform_int_distribution<int> dist(0, RAND_MAX);
-
-    return ObjectHolder::Own(ValueObject(dist(rng)));
+Value Interpreter::Eval(AST::Rand* node) {
+    return Value::Int(rng_.Next());
 }
 
-ObjectHolder Interpreter::Eval(AST::Return* node) {
-    return_result = std::make_unique<ObjectHolder>(
-        node->expr ? Eval(node->expr.get()) : ObjectHolder::None());
-    return *return_result;
+Interpreter::Completion Interpreter::Exec(AST::Return* node) {
+    return_value_ = node->expr ? Eval(node->expr.get()) : Value::None();
+    return Completion::Return;
 }
 
-ObjectHolder Interpreter::Eval(AST::StringLiteral* node) {
-    return ObjectHolder::Own(ValueObject(node->value));
+Value Interpreter::Eval(AST::StringLiteral* node) {
+    return Value::String(node->value);
 }
 
-ObjectHolder Interpreter::Eval(AST::Var* node) {
-    auto* var = call_stack.Find(node->name);
+Value Interpreter::Eval(AST::Var* node) {
+    auto& var = Slot(node->ref);
     if (!var) {
-        Error(node, "Variable ", node->name, " undefined");
-    }
-    if (!(*var)) {
         Error(node, "Variable ", node->name, " uninitialized");
     }
-    return *var;
+    return var;
 }
 
-ObjectHolder Interpreter::Eval(AST::VarDef* node) {
-    call_stack.Declare(node->name, {});
-    return *call_stack.Find(node->name);
+Value Interpreter::Eval(AST::VarDef* node) {
+    Slot(node->ref) = Value::None();
+    return Value::None();
 }
 
-ObjectHolder Interpreter::Eval(AST::While* node) {
-    bool stop = false;
-    while (!stop) {
+Interpreter::Completion Interpreter::Exec(AST::While* node) {
+    while (true) {
         auto cond = Eval(node->condition.get());
-        auto cond_bool = cond.TryAs<Bool>();
-        if (!cond_bool) {
+        if (!cond.IsBool()) {
             Error(node, "If condition is not bool");
         }
-        if (!cond.TryAs<Bool>()->GetValue()) {
-            break;
+        if (!cond.AsBool()) {
+            return Completion::Normal;
         }
-        call_stack.PushScope();
-        for (auto stmt : node->body) {
-            Eval(stmt.get());
-            if (return_result) {
-                stop = true;
-            }
+        if (profile_) ++profile_->counter;
+        if (Exec(node->body) == Completion::Return) {
+            return Completion::Return;
         }
-        call_stack.PopScope();
     }
-    return ObjectHolder::None();
 }
 
-ObjectHolder Interpreter::Eval(AST::ASTNode* node) {
+Value Interpreter::Eval(AST::ASTNode* node) {
+    if (profiler_) profiler_->Visit(node);
     switch (node->node_type) {
         case AST::NodeType::ArithOp: {
             return Eval(static_cast<AST::ArithOp*>(node));
@@ -311,10 +340,8 @@ ObjectHolder Interpreter::Eval(AST::ASTNode* node) {
             return Eval(static_cast<AST::FunCall*>(node));
         }
         case AST::NodeType::Function: {
-            return Eval(static_cast<AST::Function*>(node), {});
-        }
-        case AST::NodeType::IfThenElse: {
-            return Eval(static_cast<AST::IfThenElse*>(node));
+            auto* func = static_cast<AST::Function*>(node);
+            return Eval(func, stack_.Push(func->frame_size));
         }
         case AST::NodeType::Integer: {
             return Eval(static_cast<AST::Integer*>(node));
@@ -331,9 +358,6 @@ ObjectHolder Interpreter::Eval(AST::ASTNode* node) {
         case AST::NodeType::Rand: {
             return Eval(static_cast<AST::Rand*>(node));
         }
-        case AST::NodeType::Return: {
-            return Eval(static_cast<AST::Return*>(node));
-        }
         case AST::NodeType::StringLiteral: {
             return Eval(static_cast<AST::StringLiteral*>(node));
         }
@@ -343,12 +367,9 @@ ObjectHolder Interpreter::Eval(AST::ASTNode* node) {
         case AST::NodeType::VarDef: {
             return Eval(static_cast<AST::VarDef*>(node));
         }
-        case AST::NodeType::While: {
-            return Eval(static_cast<AST::While*>(node));
-        }
         default:
             Error(node, "unknown node");
     }
 
-    return ObjectHolder::None();
+    return Value::None();
 }
@@ -8,126 +8,88 @@
 #include <vector>
 
 #include "ast/ast.h"
-#include "call_stack.h"
+#include "ast/var_ref.h"
+#include "frame_stack.h"
 #include "ir.h"
+#include "jit.h"
+#include "output_buffer.h"
+#include "random_generator.h"
+#include "sampling_profiler.h"
+#include "value.h"
 
-class Object;
-
-class ObjectHolder {
+class Interpreter {
    public:
-    ObjectHolder() = default;
-
-    template <typename T>
-    static ObjectHolder Own(T&& object) {
-        return ObjectHolder(std::make_shared<T>(std::forward<T>(object)));
-    }
-    static ObjectHolder None() { return {}; }
-
-    Object& operator*() { return *Get(); }
+    // Calls plus loop iterations after which a function is compiled to
+    // native code when the JIT is enabled.
+    static constexpr int kDefaultJitThreshold = 100;
 
-    const Object& operator*() const { return *Get(); }
+    Interpreter(const IR& ir, OutputBuffer& out) : ir_(ir), out_(out) {}
 
-    Object* operator->() { return Get(); }
-
-    const Object* operator->() const { return Get(); }
-
-    Object* Get() { return data.get(); }
-
-    const Object* Get() const { return data.get(); }
-
-    template <typename T>
-    T* TryAs() {
-        return dynamic_cast<T*>(this->Get());
-    }
+    int Exec();
 
-    template <typename T>
-    const T* TryAs() const {
-        return dynamic_cast<const T*>(this->Get());
+    // Enables tier-up: once the calls and loop back-edges counted for a
+    // function exceed threshold, later calls to it run native code. Only
+    // functions the JIT supports are compiled; the others keep being
+    // interpreted.
+    void EnableJit(int threshold = kDefaultJitThreshold) {
+        jit_threshold_ = threshold;
     }
 
-    explicit operator bool() const { return Get(); }
+    int JitCompiledCount() const;
 
-   private:
-    ObjectHolder(std::shared_ptr<Object> new_data)
-        : data(std::move(new_data)) {}
+    // Reports the nodes visited and the functions entered to profiler,
+    // which must outlive Exec.
+    void SetProfiler(SamplingProfiler* profiler) { profiler_ = profiler; }
 
-    std::shared_ptr<Object> data;
-};
-
-class Object {
-   public:
-    virtual ~Object() = default;
-    virtual void Print(std::ostream& os) = 0;
-};
-
-template <typename T>
-class ValueObject : public Object {
-   public:
-    ValueObject(T v) : value(v) {}
-
-    void Print(std::ostream& os) override { os << value; }
-
-    const T& GetValue() const { return value; }
+    // Makes rand() return the same sequence on every run with this seed.
+    void SetSeed(uint64_t seed) { rng_.Seed(seed); }
 
    private:
-    T value;
-};
-
-using Number = ValueObject<int>;
-using Bool = ValueObject<bool>;
-
-class ArrayObject : public Object {
-   public:
-    void Print(std::ostream& os) override {
-        throw std::runtime_error("call ArrayObject Print");
+    struct Profile {
+        int counter = 0;
+        bool rejected = false;
+        std::unique_ptr<JitFunction> code;
+    };
+
+    // How a statement completed. A return leaves its value in
+    // return_value_ and unwinds the enclosing blocks up to the function.
+    enum class Completion { Normal, Return };
+
+    Completion Exec(AST::ASTNode* node);
+    Completion Exec(const AST::Statements& stmts);
+    Completion Exec(AST::IfThenElse* node);
+    Completion Exec(AST::Return* node);
+    Completion Exec(AST::While* node);
+
+    Value Eval(AST::ArithOp* node);
+    Value Eval(AST::ArrayAccess* node);
+    Value Eval(AST::ArrayAssignment* node);
+    Value Eval(AST::ArrayDeclaration* node);
+    Value Eval(AST::Assign* node);
+    Value Eval(AST::ASTNode* node);
+    Value Eval(AST::BoolLiteral* node);
+    Value Eval(AST::FunCall* node);
+    // Runs a function in a frame already pushed on stack_ and pops it.
+    Value Eval(AST::Function* node, Value* frame);
+    Value Eval(AST::Integer* node);
+    Value Eval(AST::LogicOp* node);
+    Value Eval(AST::Print* node);
+    Value Eval(AST::Program* node);
+    Value Eval(AST::Rand* node);
+    Value Eval(AST::StringLiteral* node);
+    Value Eval(AST::Var* node);
+    Value Eval(AST::VarDef* node);
+
+    // Returns the profile of a function when the JIT is enabled, compiling
+    // it once it gets hot.
+    Profile* Tier(AST::Function* node);
+    Value CallNative(AST::Function* node, const JitFunction& code,
+                     Value* frame);
+
+    Value& Slot(const AST::VarRef& ref) {
+        return ref.IsGlobal() ? globals_[ref.index] : frame_[ref.index];
     }
 
-    const ObjectHolder GetObject(size_t i) const {
-        if (i >= value.size()) {
-            throw std::runtime_error("array access " + std::to_string(i) +
-                                     " out of bounds " +
-                                     std::to_string(value.size()));
-        }
-        return value[i];
-    }
-
-    void SetObject(size_t ind, ObjectHolder val) {
-        value.resize(std::max(value.size(), ind + 1));
-        value.at(ind) = val;
-    }
-
-   private:
-    std::vector<ObjectHolder> value;
-};
-
-class Interpreter {
-   public:
-    Interpreter(const IR& ir, std::ostream& os) : ir_(ir), os_(os) {}
-
-    int Exec();
-
-   private:
-    ObjectHolder Eval(AST::ArithOp* node);
-    ObjectHolder Eval(AST::ArrayAccess* node);
-    ObjectHolder Eval(AST::ArrayAssignment* node);
-    ObjectHolder Eval(AST::ArrayDeclaration* node);
-    ObjectHolder Eval(AST::Assign* node);
-    ObjectHolder Eval(AST::ASTNode* node);
-    ObjectHolder Eval(AST::BoolLiteral* node);
-    ObjectHolder Eval(AST::FunCall* node);
-    ObjectHolder Eval(AST::Function* node, std::vector<ObjectHolder> args);
-    ObjectHolder Eval(AST::IfThenElse* node);
-    ObjectHolder Eval(AST::Integer* node);
-    ObjectHolder Eval(AST::LogicOp* node);
-    ObjectHolder Eval(AST::Print* node);
-    ObjectHolder Eval(AST::Program* node);
-    ObjectHolder Eval(AST::Rand* node);
-    ObjectHolder Eval(AST::Return* node);
-    ObjectHolder Eval(AST::StringLiteral* node);
-    ObjectHolder Eval(AST::Var* node);
-    ObjectHolder Eval(AST::VarDef* node);
-    ObjectHolder Eval(AST::While* node);
-
     template <typename... Args>
     void Error(AST::ASTNode* node, Args... args) {
         std::ostringstream oss;
@@ -138,10 +100,25 @@ class Interpreter {
     }
 
     IR ir_;
-    std::ostream& os_;
+    OutputBuffer& out_;
+
+    std::vector<Value> globals_;
+    FrameStack<Value> stack_;
+    // Slots of the function being executed, a window into stack_.
+    Value* frame_ = nullptr;
+    std::unordered_map<AST::Symbol, std::shared_ptr<AST::Function>> functions;
+
+    int jit_threshold_ = -1;
+    std::unique_ptr<JitCompiler> jit_;
+    std::unordered_map<AST::Function*, Profile> profiles_;
+    // Profile of the function being executed, counting loop back-edges.
+    Profile* profile_ = nullptr;
+
+    Value return_value_;
 
-    CallStack<ObjectHolder> call_stack;
-    std::unordered_map<std::string, std::shared_ptr<AST::Function>> functions;
+    SamplingProfiler* profiler_ = nullptr;
 
-    std::unique_ptr<ObjectHolder> return_result;
+    // Per interpreter, so that programs run on several threads share no
+    // state.
+    RandomGenerator rng_;
 };
\ No newline at end of file
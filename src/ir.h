@@ -1,9 +1,9 @@
 #pragma once
 
-#include <string>
 #include <unordered_map>
 
 #include "ast/function.h"
+#include "ast/symbol.h"
 #include "ast/type.h"
 
 struct SymbolInfo {
@@ -12,24 +12,37 @@ struct SymbolInfo {
 
 class IR {
    public:
-    void AddSymbol(const std::string& name, const SymbolInfo symbol_info) {
+    void AddSymbol(AST::Symbol name, const SymbolInfo symbol_info) {
         symbols_[name] = symbol_info;
     }
 
-    void AddFunction(const std::string& name,
-                     std::shared_ptr<AST::Function> func) {
+    void AddFunction(AST::Symbol name, std::shared_ptr<AST::Function> func) {
         functions_[name] = func;
     }
 
-    std::shared_ptr<AST::Function> GetFunction(const std::string& name) const {
+    std::shared_ptr<AST::Function> GetFunction(AST::Symbol name) const {
         return functions_.at(name);
     }
 
+    size_t FunctionCount() const { return functions_.size(); }
+
+    const std::unordered_map<AST::Symbol, SymbolInfo>& GetSymbols() const {
+        return symbols_;
+    }
+    const std::unordered_map<AST::Symbol, std::shared_ptr<AST::Function>>&
+    GetFunctions() const {
+        return functions_;
+    }
+
+    void SetGlobalCount(int count) { global_count_ = count; }
+    int GetGlobalCount() const { return global_count_; }
+
     void SetAST(std::shared_ptr<AST::ASTNode> ast) { ast_ = ast; }
     std::shared_ptr<AST::ASTNode> GetAST() const { return ast_; }
 
    private:
-    std::unordered_map<std::string, SymbolInfo> symbols_;
-    std::unordered_map<std::string, std::shared_ptr<AST::Function>> functions_;
+    std::unordered_map<AST::Symbol, SymbolInfo> symbols_;
+    std::unordered_map<AST::Symbol, std::shared_ptr<AST::Function>> functions_;
     std::shared_ptr<AST::ASTNode> ast_;
+    int global_count_ = 0;
 };
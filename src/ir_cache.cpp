@@ -0,0 +1,805 @@
+#include "ir_cache.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "ast/arithmetic_op.h"
+#include "ast/array.h"
+#include "ast/assign.h"
+#include "ast/bool_literal.h"
+#include "ast/fun_call.h"
+#include "ast/function.h"
+#include "ast/if_then_else.h"
+#include "ast/integer.h"
+#include "ast/logic_op.h"
+#include "ast/print.h"
+#include "ast/program.h"
+#include "ast/rand.h"
+#include "ast/return.h"
+#include "ast/string_literal.h"
+#include "ast/var.h"
+#include "ast/while.h"
+#include "source_file.h"
+
+namespace {
+
+constexpr char kMagic[8] = {'E', 'Z', 'I', 'R', 'C', 'A', 'C', 'H'};
+// Bumped whenever the layout or the meaning of a record changes.
+constexpr uint32_t kVersion = 2;
+
+// All records are made of 32-bit fields, so every table is aligned once
+// the header is.
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t global_count;
+    uint64_t key;
+    // FNV-1a of the whole file, computed with this field zero.
+    uint64_t checksum;
+    // Number of entries in each table, in file order.
+    uint32_t symbol_count;
+    uint32_t param_count;
+    uint32_t child_count;
+    uint32_t node_count;
+    uint32_t symbol_info_count;
+    uint32_t function_count;
+    uint32_t string_bytes;
+    // Index of the Program node.
+    int32_t root;
+};
+
+struct StringRef {
+    uint32_t offset;
+    uint32_t size;
+};
+
+struct TypeRecord {
+    int32_t base;
+    int32_t is_array;
+    int32_t array_size;
+};
+
+struct ParamRecord {
+    int32_t symbol;
+    TypeRecord type;
+};
+
+// One node of any kind. Fields a kind has no use for are zero or -1.
+struct NodeRecord {
+    int32_t node_type;
+    int32_t line;
+    int32_t column;
+    // Name of the variable, array, function or callee.
+    int32_t symbol;
+    // Expression type, declared type or return type.
+    TypeRecord type;
+    int32_t ref_scope;
+    int32_t ref_index;
+    // Literal value, operator, check_bounds or frame size.
+    int32_t value;
+    // Node indices of up to two operands, -1 when absent.
+    int32_t child[2];
+    // Ranges in the child table, or the parameter table for the first
+    // list of a function.
+    uint32_t list_begin[2];
+    uint32_t list_size[2];
+    // Value of a string literal.
+    StringRef string;
+};
+
+struct SymbolInfoRecord {
+    int32_t symbol;
+    TypeRecord type;
+};
+
+struct FunctionRecord {
+    int32_t symbol;
+    int32_t node;
+};
+
+// Thrown on a cache whose records do not fit together.
+struct CorruptCache : std::runtime_error {
+    CorruptCache() : std::runtime_error("corrupt IR cache") {}
+};
+
+TypeRecord ToRecord(const AST::Type& type) {
+    return {static_cast<int32_t>(type.base), type.is_array, type.array_size};
+}
+
+AST::Type FromRecord(const TypeRecord& record) {
+    if (record.base < static_cast<int32_t>(AST::BaseType::Unknown) ||
+        record.base > static_cast<int32_t>(AST::BaseType::Bool) ||
+        (record.is_array != 0 && record.is_array != 1) ||
+        record.array_size < 0) {
+        throw CorruptCache();
+    }
+    AST::Type type;
+    type.base = static_cast<AST::BaseType>(record.base);
+    type.is_array = record.is_array;
+    type.array_size = record.array_size;
+    return type;
+}
+
+uint64_t Checksum(std::string_view data) {
+    Header header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    header.checksum = 0;
+
+    uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](const char* bytes, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= static_cast<unsigned char>(bytes[i]);
+            hash *= 1099511628211ull;
+        }
+    };
+    mix(reinterpret_cast<const char*>(&header), sizeof(header));
+    mix(data.data() + sizeof(header), data.size() - sizeof(header));
+    return hash;
+}
+
+// Where a node may appear; Build checks every child against its slot.
+enum class Slot { Expr, Stmt, Global };
+
+bool Fits(AST::NodeType type, Slot slot) {
+    switch (type) {
+        case AST::NodeType::ArithOp:
+        case AST::NodeType::ArrayAccess:
+        case AST::NodeType::BoolLiteral:
+        case AST::NodeType::FunCall:
+        case AST::NodeType::Integer:
+        case AST::NodeType::LogicOp:
+        case AST::NodeType::Rand:
+        case AST::NodeType::StringLiteral:
+        case AST::NodeType::Var:
+            // Expression statements are allowed.
+            return slot != Slot::Global;
+        case AST::NodeType::ArrayDeclaration:
+        case AST::NodeType::VarDef:
+            return slot != Slot::Expr;
+        case AST::NodeType::ArrayAssignment:
+        case AST::NodeType::Assign:
+        case AST::NodeType::IfThenElse:
+        case AST::NodeType::Print:
+        case AST::NodeType::Return:
+        case AST::NodeType::While:
+            return slot == Slot::Stmt;
+        case AST::NodeType::Function:
+            return slot == Slot::Global;
+        default:
+            return false;
+    }
+}
+
+class Writer {
+   public:
+    explicit Writer(const IR& ir) : ir_(ir) {}
+
+    std::string Write(uint64_t key) {
+        Header header = {};
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = kVersion;
+        header.global_count = ir_.GetGlobalCount();
+        header.key = key;
+        header.root = Add(ir_.GetAST().get());
+
+        std::vector<SymbolInfoRecord> symbol_infos;
+        for (const auto& [name, info] : ir_.GetSymbols()) {
+            symbol_infos.push_back({Symbol(name), ToRecord(info.type)});
+        }
+        std::vector<FunctionRecord> functions;
+        for (const auto& [name, function] : ir_.GetFunctions()) {
+            functions.push_back({Symbol(name), Add(function.get())});
+        }
+
+        header.symbol_count = symbols_.size();
+        header.param_count = params_.size();
+        header.child_count = children_.size();
+        header.node_count = nodes_.size();
+        header.symbol_info_count = symbol_infos.size();
+        header.function_count = functions.size();
+        header.string_bytes = strings_.size();
+
+        std::string out;
+        Append(&out, &header, 1);
+        Append(&out, symbols_.data(), symbols_.size());
+        Append(&out, params_.data(), params_.size());
+        Append(&out, children_.data(), children_.size());
+        Append(&out, nodes_.data(), nodes_.size());
+        Append(&out, symbol_infos.data(), symbol_infos.size());
+        Append(&out, functions.data(), functions.size());
+        out += strings_;
+
+        header.checksum = Checksum(out);
+        std::memcpy(&out[0], &header, sizeof(header));
+        return out;
+    }
+
+   private:
+    template <typename T>
+    static void Append(std::string* out, const T* data, size_t count) {
+        out->append(reinterpret_cast<const char*>(data), sizeof(T) * count);
+    }
+
+    StringRef String(std::string_view text) {
+        StringRef ref = {static_cast<uint32_t>(strings_.size()),
+                         static_cast<uint32_t>(text.size())};
+        strings_ += text;
+        return ref;
+    }
+
+    int32_t Symbol(AST::Symbol symbol) {
+        auto [iter, inserted] = symbol_index_.try_emplace(
+            symbol.Id(), static_cast<int32_t>(symbols_.size()));
+        if (inserted) symbols_.push_back(String(symbol.Str()));
+        return iter->second;
+    }
+
+    template <typename T>
+    std::pair<uint32_t, uint32_t> AddList(
+        const std::vector<std::shared_ptr<T>>& list) {
+        // Children are added before the list, which has to be contiguous.
+        std::vector<int32_t> indices;
+        for (const auto& node : list) indices.push_back(Add(node.get()));
+        uint32_t begin = children_.size();
+        children_.insert(children_.end(), indices.begin(), indices.end());
+        return {begin, static_cast<uint32_t>(indices.size())};
+    }
+
+    // Adds the subtree of node after its children; returns its index.
+    int32_t Add(const AST::ASTNode* node) {
+        if (!node) return -1;
+        if (auto iter = node_index_.find(node); iter != node_index_.end()) {
+            return iter->second;
+        }
+
+        NodeRecord record = {};
+        record.node_type = static_cast<int32_t>(node->node_type);
+        record.line = node->loc.line;
+        record.column = node->loc.column;
+        record.symbol = -1;
+        record.ref_index = -1;
+        record.child[0] = -1;
+        record.child[1] = -1;
+        if (auto* expr = dynamic_cast<const AST::Expr*>(node)) {
+            record.type = ToRecord(expr->type);
+        }
+        auto set_ref = [&record](const AST::VarRef& ref) {
+            record.ref_scope = static_cast<int32_t>(ref.scope);
+            record.ref_index = ref.index;
+        };
+        auto set_list = [&record](int i, std::pair<uint32_t, uint32_t> list) {
+            record.list_begin[i] = list.first;
+            record.list_size[i] = list.second;
+        };
+
+        switch (node->node_type) {
+            case AST::NodeType::ArithOp: {
+                auto* op = static_cast<const AST::ArithOp*>(node);
+                record.value = static_cast<int32_t>(op->op);
+                record.child[0] = Add(op->lhs.get());
+                record.child[1] = Add(op->rhs.get());
+                break;
+            }
+            case AST::NodeType::ArrayAccess: {
+                auto* access = static_cast<const AST::ArrayAccess*>(node);
+                record.symbol = Symbol(access->name);
+                set_ref(access->ref);
+                record.value = access->check_bounds;
+                record.child[0] = Add(access->index.get());
+                break;
+            }
+            case AST::NodeType::ArrayAssignment: {
+                auto* assign = static_cast<const AST::ArrayAssignment*>(node);
+                record.symbol = Symbol(assign->name);
+                set_ref(assign->ref);
+                record.value = assign->check_bounds;
+                record.child[0] = Add(assign->index.get());
+                record.child[1] = Add(assign->expr.get());
+                break;
+            }
+            case AST::NodeType::ArrayDeclaration: {
+                auto* decl = static_cast<const AST::ArrayDeclaration*>(node);
+                record.symbol = Symbol(decl->name);
+                record.type = ToRecord(decl->type);
+                set_ref(decl->ref);
+                break;
+            }
+            case AST::NodeType::Assign: {
+                auto* assign = static_cast<const AST::Assign*>(node);
+                record.symbol = Symbol(assign->var);
+                set_ref(assign->ref);
+                record.child[0] = Add(assign->expr.get());
+                break;
+            }
+            case AST::NodeType::BoolLiteral:
+                record.value =
+                    static_cast<const AST::BoolLiteral*>(node)->value;
+                break;
+            case AST::NodeType::FunCall: {
+                // The target is found by name when loading.
+                auto* call = static_cast<const AST::FunCall*>(node);
+                record.symbol = Symbol(call->name);
+                set_list(0, AddList(call->args));
+                break;
+            }
+            case AST::NodeType::Function: {
+                auto* function = static_cast<const AST::Function*>(node);
+                record.symbol = Symbol(function->name);
+                record.type = ToRecord(function->return_type);
+                record.value = function->frame_size;
+                set_list(1, AddList(function->body));
+                record.list_begin[0] = params_.size();
+                record.list_size[0] = function->args.size();
+                for (const auto& param : function->args) {
+                    params_.push_back(
+                        {Symbol(param.name), ToRecord(param.type)});
+                }
+                break;
+            }
+            case AST::NodeType::IfThenElse: {
+                auto* branch = static_cast<const AST::IfThenElse*>(node);
+                record.child[0] = Add(branch->condition.get());
+                set_list(0, AddList(branch->then_branch));
+                set_list(1, AddList(branch->else_branch));
+                break;
+            }
+            case AST::NodeType::Integer:
+                record.value = static_cast<const AST::Integer*>(node)->value;
+                break;
+            case AST::NodeType::LogicOp: {
+                auto* op = static_cast<const AST::LogicOp*>(node);
+                record.value = static_cast<int32_t>(op->op);
+                record.child[0] = Add(op->lhs.get());
+                record.child[1] = Add(op->rhs.get());
+                break;
+            }
+            case AST::NodeType::Print:
+                record.child[0] =
+                    Add(static_cast<const AST::Print*>(node)->expr.get());
+                break;
+            case AST::NodeType::Program: {
+                auto* program = static_cast<const AST::Program*>(node);
+                set_list(0, AddList(program->globals));
+                break;
+            }
+            case AST::NodeType::Rand:
+                break;
+            case AST::NodeType::Return: {
+                auto* ret = static_cast<const AST::Return*>(node);
+                record.type = ToRecord(ret->type);
+                record.child[0] = Add(ret->expr.get());
+                break;
+            }
+            case AST::NodeType::StringLiteral:
+                record.string = String(
+                    static_cast<const AST::StringLiteral*>(node)->value);
+                break;
+            case AST::NodeType::Var: {
+                auto* var = static_cast<const AST::Var*>(node);
+                record.symbol = Symbol(var->name);
+                set_ref(var->ref);
+                break;
+            }
+            case AST::NodeType::VarDef: {
+                auto* def = static_cast<const AST::VarDef*>(node);
+                record.symbol = Symbol(def->name);
+                record.type = ToRecord(def->type);
+                set_ref(def->ref);
+                break;
+            }
+            case AST::NodeType::While: {
+                auto* loop = static_cast<const AST::While*>(node);
+                record.child[0] = Add(loop->condition.get());
+                set_list(0, AddList(loop->body));
+                break;
+            }
+            default:
+                throw std::runtime_error("cannot cache node");
+        }
+
+        int32_t index = nodes_.size();
+        nodes_.push_back(record);
+        node_index_.emplace(node, index);
+        return index;
+    }
+
+    const IR& ir_;
+
+    std::vector<StringRef> symbols_;
+    std::vector<ParamRecord> params_;
+    std::vector<int32_t> children_;
+    std::vector<NodeRecord> nodes_;
+    std::string strings_;
+
+    std::unordered_map<uint32_t, int32_t> symbol_index_;
+    std::unordered_map<const AST::ASTNode*, int32_t> node_index_;
+};
+
+class Reader {
+   public:
+    explicit Reader(std::string_view data) : data_(data) {}
+
+    std::optional<IR> Read(uint64_t key) {
+        if (data_.size() < sizeof(Header)) return std::nullopt;
+        header_ = reinterpret_cast<const Header*>(data_.data());
+        if (std::memcmp(header_->magic, kMagic, sizeof(kMagic)) != 0 ||
+            header_->version != kVersion || header_->key != key) {
+            return std::nullopt;
+        }
+        // Catches damage that still forms a valid program, such as a
+        // changed literal or a dropped bounds check.
+        if (Checksum(data_) != header_->checksum) throw CorruptCache();
+        if (header_->global_count > header_->node_count) throw CorruptCache();
+
+        size_t offset = sizeof(Header);
+        symbols_ = Table<StringRef>(&offset, header_->symbol_count);
+        params_ = Table<ParamRecord>(&offset, header_->param_count);
+        children_ = Table<int32_t>(&offset, header_->child_count);
+        nodes_ = Table<NodeRecord>(&offset, header_->node_count);
+        auto* symbol_infos =
+            Table<SymbolInfoRecord>(&offset, header_->symbol_info_count);
+        auto* functions =
+            Table<FunctionRecord>(&offset, header_->function_count);
+        strings_ = data_.substr(offset);
+        if (strings_.size() != header_->string_bytes) throw CorruptCache();
+
+        symbol_table_.reserve(header_->symbol_count);
+        for (uint32_t i = 0; i < header_->symbol_count; ++i) {
+            symbol_table_.emplace_back(String(symbols_[i]));
+        }
+
+        IR ir;
+        nodes_built_.resize(header_->node_count);
+        for (uint32_t i = 0; i < header_->node_count; ++i) {
+            nodes_built_[i] = Build(nodes_[i]);
+        }
+        if (max_local_ != -1) throw CorruptCache();
+        auto root = Node(header_->root);
+        if (!root || root->node_type != AST::NodeType::Program) {
+            throw CorruptCache();
+        }
+        ir.SetAST(root);
+        ir.SetGlobalCount(header_->global_count);
+        for (uint32_t i = 0; i < header_->symbol_info_count; ++i) {
+            ir.AddSymbol(Symbol(symbol_infos[i].symbol),
+                         {FromRecord(symbol_infos[i].type)});
+        }
+        for (uint32_t i = 0; i < header_->function_count; ++i) {
+            auto function = Node(functions[i].node);
+            if (function->node_type != AST::NodeType::Function) {
+                throw CorruptCache();
+            }
+            ir.AddFunction(Symbol(functions[i].symbol),
+                           std::static_pointer_cast<AST::Function>(function));
+        }
+
+        for (auto* call : calls_) {
+            auto& table = ir.GetFunctions();
+            auto iter = table.find(call->name);
+            if (iter == table.end() ||
+                iter->second->args.size() != call->args.size()) {
+                throw CorruptCache();
+            }
+            call->target = iter->second.get();
+        }
+        return ir;
+    }
+
+   private:
+    template <typename T>
+    const T* Table(size_t* offset, uint32_t count) {
+        size_t size = sizeof(T) * count;
+        if (data_.size() - *offset < size) throw CorruptCache();
+        auto* table = reinterpret_cast<const T*>(data_.data() + *offset);
+        *offset += size;
+        return table;
+    }
+
+    std::string_view String(const StringRef& ref) const {
+        if (ref.offset > strings_.size() ||
+            strings_.size() - ref.offset < ref.size) {
+            throw CorruptCache();
+        }
+        return strings_.substr(ref.offset, ref.size);
+    }
+
+    AST::Symbol Symbol(int32_t index) const {
+        if (index < 0 || static_cast<size_t>(index) >= symbol_table_.size()) {
+            throw CorruptCache();
+        }
+        return symbol_table_[index];
+    }
+
+    // An already built node, nullptr for -1.
+    std::shared_ptr<AST::ASTNode> Node(int32_t index) const {
+        if (index == -1) return nullptr;
+        if (index < 0 || static_cast<size_t>(index) >= built_) {
+            throw CorruptCache();
+        }
+        return nodes_built_[index];
+    }
+
+    // An already built node that may fill slot; nullptr for -1 if the
+    // child is optional.
+    std::shared_ptr<AST::ASTNode> Node(int32_t index, Slot slot,
+                                       bool optional = false) const {
+        auto node = Node(index);
+        if (node ? !Fits(node->node_type, slot) : !optional) {
+            throw CorruptCache();
+        }
+        return node;
+    }
+
+    std::shared_ptr<AST::Expr> Expr(const NodeRecord& record, int i,
+                                    bool optional = false) const {
+        return std::static_pointer_cast<AST::Expr>(
+            Node(record.child[i], Slot::Expr, optional));
+    }
+
+    template <typename T = AST::ASTNode>
+    std::vector<std::shared_ptr<T>> List(const NodeRecord& record, int i,
+                                         Slot slot) const {
+        uint32_t begin = record.list_begin[i];
+        uint32_t size = record.list_size[i];
+        if (begin > header_->child_count ||
+            header_->child_count - begin < size) {
+            throw CorruptCache();
+        }
+        std::vector<std::shared_ptr<T>> list;
+        list.reserve(size);
+        for (uint32_t j = 0; j < size; ++j) {
+            list.push_back(
+                std::static_pointer_cast<T>(Node(children_[begin + j], slot)));
+        }
+        return list;
+    }
+
+    // Locals are checked against the frame of their function, which
+    // follows its body in post-order.
+    AST::VarRef Ref(const NodeRecord& record) {
+        auto scope = static_cast<AST::VarRef::Scope>(record.ref_scope);
+        int32_t index = record.ref_index;
+        if (scope == AST::VarRef::Scope::Global) {
+            if (index < 0 ||
+                static_cast<uint32_t>(index) >= header_->global_count) {
+                throw CorruptCache();
+            }
+        } else if (scope == AST::VarRef::Scope::Local && index >= 0) {
+            max_local_ = std::max(max_local_, index);
+        } else {
+            throw CorruptCache();
+        }
+        return {scope, index};
+    }
+
+    static AST::Operator Operator(const NodeRecord& record,
+                                  AST::Operator first, AST::Operator last) {
+        if (record.value < static_cast<int32_t>(first) ||
+            record.value > static_cast<int32_t>(last)) {
+            throw CorruptCache();
+        }
+        return static_cast<AST::Operator>(record.value);
+    }
+
+    template <typename T, typename... Args>
+    std::shared_ptr<T> Make(Args&&... args) {
+        return std::make_shared<T>(std::forward<Args>(args)...);
+    }
+
+    std::shared_ptr<AST::ASTNode> Build(const NodeRecord& record) {
+        auto node = BuildNode(record);
+        node->loc = {record.line, record.column};
+        if (auto* expr = dynamic_cast<AST::Expr*>(node.get())) {
+            if (node->node_type != AST::NodeType::VarDef) {
+                expr->type = FromRecord(record.type);
+            }
+        }
+        ++built_;
+        return node;
+    }
+
+    std::shared_ptr<AST::ASTNode> BuildNode(const NodeRecord& record) {
+        switch (static_cast<AST::NodeType>(record.node_type)) {
+            case AST::NodeType::ArithOp: {
+                auto node = Make<AST::ArithOp>();
+                node->op = Operator(record, AST::Operator::Add,
+                                    AST::Operator::Mod);
+                node->lhs = Expr(record, 0);
+                node->rhs = Expr(record, 1);
+                return node;
+            }
+            case AST::NodeType::ArrayAccess: {
+                auto node = Make<AST::ArrayAccess>();
+                node->name = Symbol(record.symbol);
+                node->ref = Ref(record);
+                node->check_bounds = record.value;
+                node->index = Expr(record, 0);
+                return node;
+            }
+            case AST::NodeType::ArrayAssignment: {
+                auto node = Make<AST::ArrayAssignment>();
+                node->name = Symbol(record.symbol);
+                node->ref = Ref(record);
+                node->check_bounds = record.value;
+                node->index = Expr(record, 0);
+                node->expr = Expr(record, 1);
+                return node;
+            }
+            case AST::NodeType::ArrayDeclaration: {
+                auto node = Make<AST::ArrayDeclaration>();
+                node->name = Symbol(record.symbol);
+                node->type = FromRecord(record.type);
+                node->ref = Ref(record);
+                return node;
+            }
+            case AST::NodeType::Assign: {
+                auto node = Make<AST::Assign>();
+                node->var = Symbol(record.symbol);
+                node->ref = Ref(record);
+                node->expr = Expr(record, 0);
+                return node;
+            }
+            case AST::NodeType::BoolLiteral:
+                return Make<AST::BoolLiteral>(record.value);
+            case AST::NodeType::FunCall: {
+                auto node = Make<AST::FunCall>();
+                node->name = Symbol(record.symbol);
+                node->args = List<AST::Expr>(record, 0, Slot::Expr);
+                calls_.push_back(node.get());
+                return node;
+            }
+            case AST::NodeType::Function: {
+                auto node = Make<AST::Function>();
+                node->name = Symbol(record.symbol);
+                node->return_type = FromRecord(record.type);
+                node->frame_size = record.value;
+                node->body = List(record, 1, Slot::Stmt);
+                uint32_t begin = record.list_begin[0];
+                uint32_t size = record.list_size[0];
+                if (begin > header_->param_count ||
+                    header_->param_count - begin < size) {
+                    throw CorruptCache();
+                }
+                for (uint32_t j = 0; j < size; ++j) {
+                    const auto& param = params_[begin + j];
+                    node->args.push_back(
+                        {Symbol(param.symbol), FromRecord(param.type)});
+                }
+                // Parameters take the first slots.
+                if (node->frame_size < static_cast<int>(size) ||
+                    max_local_ >= node->frame_size) {
+                    throw CorruptCache();
+                }
+                max_local_ = -1;
+                return node;
+            }
+            case AST::NodeType::IfThenElse: {
+                auto node = Make<AST::IfThenElse>();
+                node->condition = Expr(record, 0);
+                node->then_branch = List(record, 0, Slot::Stmt);
+                node->else_branch = List(record, 1, Slot::Stmt);
+                return node;
+            }
+            case AST::NodeType::Integer:
+                return Make<AST::Integer>(record.value);
+            case AST::NodeType::LogicOp: {
+                auto node = Make<AST::LogicOp>();
+                node->op = Operator(record, AST::Operator::Less,
+                                    AST::Operator::Equal);
+                node->lhs = Expr(record, 0);
+                node->rhs = Expr(record, 1);
+                return node;
+            }
+            case AST::NodeType::Print: {
+                auto node = Make<AST::Print>();
+                node->expr = Expr(record, 0);
+                return node;
+            }
+            case AST::NodeType::Program: {
+                auto node = Make<AST::Program>();
+                node->globals = List(record, 0, Slot::Global);
+                return node;
+            }
+            case AST::NodeType::Rand:
+                return Make<AST::Rand>();
+            case AST::NodeType::Return: {
+                auto node = Make<AST::Return>(Expr(record, 0, true));
+                node->type = FromRecord(record.type);
+                return node;
+            }
+            case AST::NodeType::StringLiteral:
+                return Make<AST::StringLiteral>(
+                    std::string(String(record.string)));
+            case AST::NodeType::Var: {
+                auto node = Make<AST::Var>();
+                node->name = Symbol(record.symbol);
+                node->ref = Ref(record);
+                return node;
+            }
+            case AST::NodeType::VarDef: {
+                auto node = Make<AST::VarDef>();
+                node->name = Symbol(record.symbol);
+                node->type = FromRecord(record.type);
+                node->ref = Ref(record);
+                return node;
+            }
+            case AST::NodeType::While: {
+                auto node = Make<AST::While>();
+                node->condition = Expr(record, 0);
+                node->body = List(record, 0, Slot::Stmt);
+                return node;
+            }
+            default:
+                throw CorruptCache();
+        }
+    }
+
+    std::string_view data_;
+    const Header* header_ = nullptr;
+    const StringRef* symbols_ = nullptr;
+    const ParamRecord* params_ = nullptr;
+    const int32_t* children_ = nullptr;
+    const NodeRecord* nodes_ = nullptr;
+    std::string_view strings_;
+
+    std::vector<AST::Symbol> symbol_table_;
+    std::vector<std::shared_ptr<AST::ASTNode>> nodes_built_;
+    size_t built_ = 0;
+    // Highest local slot referred to since the last function.
+    int32_t max_local_ = -1;
+    std::vector<AST::FunCall*> calls_;
+};
+
+}  // namespace
+
+uint64_t IRCacheKey(std::string_view source, int inline_budget) {
+    // FNV-1a over the source, then the options that shape the IR.
+    uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](const void* data, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= static_cast<const unsigned char*>(data)[i];
+            hash *= 1099511628211ull;
+        }
+    };
+    mix(source.data(), source.size());
+    mix(&kVersion, sizeof(kVersion));
+    mix(&inline_budget, sizeof(inline_budget));
+    return hash;
+}
+
+bool SaveIR(const IR& ir, uint64_t key, const std::string& path) {
+    std::string data = Writer(ir).Write(key);
+
+    std::string temp_path = path + ".tmp" + std::to_string(getpid());
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        file.write(data.data(), data.size());
+        if (!file) {
+            std::remove(temp_path.c_str());
+            return false;
+        }
+    }
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        std::remove(temp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+std::optional<IR> LoadIR(const std::string& path, uint64_t key) {
+    if (access(path.c_str(), R_OK) != 0) return std::nullopt;
+    try {
+        SourceFile file(path);
+        return Reader(file.Text()).Read(key);
+    } catch (const std::runtime_error&) {
+        return std::nullopt;
+    }
+}
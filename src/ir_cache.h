@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "ir.h"
+
+// Binary cache of a checked and optimized IR, so that running the same
+// program again skips the front end. The file is a header followed by
+// flat tables of fixed-size records: nodes in post-order, so each node
+// only refers to nodes before it, the child lists, function parameters,
+// the symbol and function tables and the text of symbols and strings.
+//
+// Loading maps the file and builds the tree in one pass over the node
+// table; the only fixups are interning the symbols and pointing calls at
+// their targets. The header records the key the IR was built for and a
+// checksum of the file. A cache with another key or format version, a
+// wrong checksum or records that do not form a well-typed tree is
+// ignored.
+
+// Key of the IR compiled from source with the given options.
+uint64_t IRCacheKey(std::string_view source, int inline_budget);
+
+// Writes ir to path through a temporary file renamed into place, so that
+// concurrent runs never read a partial cache. Returns false on I/O errors.
+bool SaveIR(const IR& ir, uint64_t key, const std::string& path);
+
+// The IR saved in path, or nullopt if there is no usable cache for key.
+std::optional<IR> LoadIR(const std::string& path, uint64_t key);
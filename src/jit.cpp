@@ -0,0 +1,558 @@
+#include "jit.h"
+
+#include <sys/mman.h>
+
+#include <cstring>
+#include <stdexcept>
+
+#include "ast/arithmetic_op.h"
+#include "ast/array.h"
+#include "ast/assign.h"
+#include "ast/bool_literal.h"
+#include "ast/function.h"
+#include "ast/if_then_else.h"
+#include "ast/integer.h"
+#include "ast/logic_op.h"
+#include "ast/return.h"
+#include "ast/var.h"
+#include "ast/while.h"
+
+using X86::Emitter;
+using X86::Reg;
+
+namespace {
+
+enum ErrorKind { kUninitialized, kDivisionByZero, kNotArray };
+
+// Registers holding the interpreter frame and the JitError pointer for the
+// whole function; both are callee-saved.
+constexpr Reg kFrame = X86::RBX;
+constexpr Reg kError = X86::R12;
+
+// Saved rbx and r12 sit right below the frame pointer.
+constexpr int32_t kSavedRegisters = 16;
+
+ArrayObject* JitNewArray(Value* slot, int32_t size) {
+    *slot = Value::NewArray(size);
+    return slot->AsArray();
+}
+
+// nullptr when the argument is an array variable declared without a size.
+ArrayObject* JitArrayOf(Value* slot) {
+    return slot->IsArray() ? slot->AsArray() : nullptr;
+}
+
+int64_t JitArrayLoad(JitError* error, const AST::ASTNode* node,
+                     ArrayObject* array, int32_t index) {
+    try {
+        return static_cast<uint32_t>(array->Load(index));
+    } catch (std::exception& ex) {
+        error->node = node;
+        error->message = ex.what();
+        return -1;
+    }
+}
+
+int64_t JitArrayStore(JitError* error, const AST::ASTNode* node,
+                      ArrayObject* array, int32_t index, int32_t value) {
+    try {
+        array->Store(index, value);
+        return 0;
+    } catch (std::exception& ex) {
+        error->node = node;
+        error->message = ex.what();
+        return -1;
+    }
+}
+
+void JitFail(JitError* error, const AST::ASTNode* node, int kind) {
+    error->node = node;
+    if (kind == kUninitialized) {
+        error->message = "Variable " +
+                         static_cast<const AST::Var*>(node)->name.Str() +
+                         " uninitialized";
+    } else if (kind == kNotArray) {
+        error->message = "Not array object";
+    } else {
+        error->message = "division by zero";
+    }
+}
+
+int32_t ValueOffset(int index) { return index * sizeof(Value); }
+
+X86::Cond Condition(AST::LogicOp* node) {
+    switch (node->op) {
+        case AST::Operator::Less:
+            return X86::Less;
+        case AST::Operator::Greater:
+            return X86::Greater;
+        case AST::Operator::Equal:
+            return X86::Equal;
+        default:
+            throw std::runtime_error("Unknown logic op: " +
+                                     std::string(AST::ToString(node->op)));
+    }
+}
+
+}  // namespace
+
+JitFunction::JitFunction(const std::vector<uint8_t>& code)
+    : size_(code.size()) {
+    memory_ = mmap(nullptr, size_, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory_ == MAP_FAILED) {
+        memory_ = nullptr;
+        throw std::runtime_error("jit: mmap failed");
+    }
+    std::memcpy(memory_, code.data(), size_);
+    if (mprotect(memory_, size_, PROT_READ | PROT_EXEC) != 0) {
+        munmap(memory_, size_);
+        memory_ = nullptr;
+        throw std::runtime_error("jit: mprotect failed");
+    }
+    entry_ = reinterpret_cast<Entry>(memory_);
+}
+
+JitFunction::~JitFunction() {
+    if (memory_) munmap(memory_, size_);
+}
+
+bool JitCompiler::IsSupported() {
+#if defined(__x86_64__) && defined(__linux__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool JitCompiler::CanCompile(AST::Function* node) {
+    if (node->return_type.is_array) return false;
+    for (auto stmt : node->body) {
+        if (!CanCompile(stmt.get())) return false;
+    }
+    return true;
+}
+
+bool JitCompiler::CanCompile(AST::ASTNode* node) {
+    switch (node->node_type) {
+        case AST::NodeType::ArithOp: {
+            auto* op = static_cast<AST::ArithOp*>(node);
+            return CanCompile(op->lhs.get()) && CanCompile(op->rhs.get());
+        }
+        case AST::NodeType::ArrayAccess: {
+            auto* access = static_cast<AST::ArrayAccess*>(node);
+            return CanCompile(access->index.get());
+        }
+        case AST::NodeType::ArrayAssignment: {
+            auto* assign = static_cast<AST::ArrayAssignment*>(node);
+            return CanCompile(assign->index.get()) &&
+                   CanCompile(assign->expr.get());
+        }
+        case AST::NodeType::Assign:
+            return CanCompile(static_cast<AST::Assign*>(node)->expr.get());
+        case AST::NodeType::IfThenElse: {
+            auto* branch = static_cast<AST::IfThenElse*>(node);
+            if (!CanCompile(branch->condition.get())) return false;
+            for (auto stmt : branch->then_branch) {
+                if (!CanCompile(stmt.get())) return false;
+            }
+            for (auto stmt : branch->else_branch) {
+                if (!CanCompile(stmt.get())) return false;
+            }
+            return true;
+        }
+        case AST::NodeType::LogicOp: {
+            auto* op = static_cast<AST::LogicOp*>(node);
+            return CanCompile(op->lhs.get()) && CanCompile(op->rhs.get());
+        }
+        case AST::NodeType::Return: {
+            auto* ret = static_cast<AST::Return*>(node);
+            return !ret->expr || CanCompile(ret->expr.get());
+        }
+        case AST::NodeType::Var:
+            return !static_cast<AST::Var*>(node)->type.is_array;
+        case AST::NodeType::While: {
+            auto* loop = static_cast<AST::While*>(node);
+            if (!CanCompile(loop->condition.get())) return false;
+            for (auto stmt : loop->body) {
+                if (!CanCompile(stmt.get())) return false;
+            }
+            return true;
+        }
+        case AST::NodeType::VarDef:
+            // Local arrays then always come from an ArrayDeclaration.
+            return !static_cast<AST::VarDef*>(node)->type.is_array;
+        case AST::NodeType::ArrayDeclaration:
+        case AST::NodeType::BoolLiteral:
+        case AST::NodeType::Integer:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::unique_ptr<JitFunction> JitCompiler::Compile(AST::Function* node) {
+    if (!IsSupported() || !CanCompile(node)) return nullptr;
+
+    emitter_ = Emitter();
+    stubs_.clear();
+    depth_ = 0;
+    initialized_.assign(node->frame_size, false);
+    param_count_ = node->args.size();
+    return_label_ = emitter_.NewLabel();
+    error_label_ = emitter_.NewLabel();
+
+    int32_t frame_bytes = (8 * node->frame_size + 15) / 16 * 16;
+    emitter_.Push(X86::RBP);
+    emitter_.Mov64(X86::RBP, X86::RSP);
+    emitter_.Push(kFrame);
+    emitter_.Push(kError);
+    if (frame_bytes > 0) emitter_.SubRsp(frame_bytes);
+    emitter_.Mov64(kFrame, X86::RDI);
+    emitter_.Mov64(kError, X86::RSI);
+
+    for (int i = 0; i < node->frame_size; ++i) {
+        if (i >= static_cast<int>(node->args.size())) {
+            // A non-zero upper half marks a slot as uninitialized.
+            emitter_.StoreImm32(X86::RBP, SlotOffset(i) + 4, 1);
+            continue;
+        }
+        if (node->args[i].type.is_array) {
+            emitter_.Lea64(X86::RDI, kFrame, ValueOffset(i));
+            CallHelper(reinterpret_cast<uint64_t>(&JitArrayOf));
+        } else {
+            emitter_.Load32(X86::RAX, kFrame,
+                            ValueOffset(i) + Value::PayloadOffset());
+        }
+        emitter_.Store64(X86::RBP, SlotOffset(i), X86::RAX);
+        SetInitialized(i, true);
+    }
+
+    CompileBlock(node->body);
+    emitter_.MovImm32(X86::RAX, 0);
+
+    emitter_.Bind(return_label_);
+    emitter_.Lea64(X86::RSP, X86::RBP, -kSavedRegisters);
+    emitter_.Pop(kError);
+    emitter_.Pop(kFrame);
+    emitter_.Pop(X86::RBP);
+    emitter_.Ret();
+
+    for (const auto& stub : stubs_) {
+        emitter_.Bind(stub.label);
+        emitter_.AndRspImm8(-16);
+        emitter_.Mov64(X86::RDI, kError);
+        emitter_.MovImm64(X86::RSI, reinterpret_cast<uint64_t>(stub.node));
+        emitter_.MovImm32(X86::RDX, stub.kind);
+        emitter_.MovImm64(X86::RAX, reinterpret_cast<uint64_t>(&JitFail));
+        emitter_.Call(X86::RAX);
+        emitter_.Jmp(error_label_);
+    }
+
+    emitter_.Bind(error_label_);
+    emitter_.MovImm64(X86::RAX, ~uint64_t{0});
+    emitter_.Jmp(return_label_);
+
+    return std::make_unique<JitFunction>(emitter_.Code());
+}
+
+void JitCompiler::CompileBlock(const AST::Statements& stmts) {
+    for (auto stmt : stmts) {
+        CompileStmt(stmt.get());
+    }
+}
+
+void JitCompiler::CompileStmt(AST::ASTNode* node) {
+    switch (node->node_type) {
+        case AST::NodeType::ArrayAssignment: {
+            auto* assign = static_cast<AST::ArrayAssignment*>(node);
+            CompileBinary(assign->index.get(), assign->expr.get());
+            emitter_.Mov32(X86::R8, X86::RCX);
+            emitter_.Mov32(X86::RCX, X86::RAX);
+            if (!assign->check_bounds) {
+                LoadArrayData(assign->ref, X86::RDX, node);
+                emitter_.StoreIndexed32(X86::RDX, X86::RCX, X86::R8);
+                break;
+            }
+            LoadArray(assign->ref, X86::RDX, node);
+            emitter_.Mov64(X86::RDI, kError);
+            emitter_.MovImm64(X86::RSI, reinterpret_cast<uint64_t>(node));
+            CallHelper(reinterpret_cast<uint64_t>(&JitArrayStore));
+            emitter_.Test64(X86::RAX, X86::RAX);
+            emitter_.Jcc(X86::Sign, error_label_);
+            break;
+        }
+        case AST::NodeType::ArrayDeclaration: {
+            auto* decl = static_cast<AST::ArrayDeclaration*>(node);
+            emitter_.Lea64(X86::RDI, kFrame, ValueOffset(decl->ref.index));
+            emitter_.MovImm32(X86::RSI, decl->type.array_size);
+            CallHelper(reinterpret_cast<uint64_t>(&JitNewArray));
+            emitter_.Store64(X86::RBP, SlotOffset(decl->ref.index), X86::RAX);
+            SetInitialized(decl->ref.index, true);
+            break;
+        }
+        case AST::NodeType::Assign: {
+            auto* assign = static_cast<AST::Assign*>(node);
+            CompileExpr(assign->expr.get());
+            if (assign->ref.IsGlobal()) {
+                auto tag = assign->expr->type.base == AST::BaseType::Bool
+                               ? Value::Tag::Bool
+                               : Value::Tag::Int;
+                emitter_.MovImm64(
+                    X86::RCX,
+                    reinterpret_cast<uint64_t>(Global(assign->ref.index)));
+                emitter_.StoreImm8(X86::RCX, Value::TagOffset(),
+                                   static_cast<uint8_t>(tag));
+                emitter_.Store32(X86::RCX, Value::PayloadOffset(), X86::RAX);
+            } else {
+                emitter_.Store64(X86::RBP, SlotOffset(assign->ref.index),
+                                 X86::RAX);
+                SetInitialized(assign->ref.index, true);
+            }
+            break;
+        }
+        case AST::NodeType::IfThenElse: {
+            auto* branch = static_cast<AST::IfThenElse*>(node);
+            auto else_label = emitter_.NewLabel();
+            auto end_label = emitter_.NewLabel();
+            CompileBranch(branch->condition.get(), else_label, false);
+
+            auto before = initialized_;
+            CompileBlock(branch->then_branch);
+            auto after_then = initialized_;
+            initialized_ = before;
+            if (!branch->else_branch.empty()) emitter_.Jmp(end_label);
+
+            emitter_.Bind(else_label);
+            CompileBlock(branch->else_branch);
+            emitter_.Bind(end_label);
+            for (size_t i = 0; i < initialized_.size(); ++i) {
+                initialized_[i] = initialized_[i] && after_then[i];
+            }
+            break;
+        }
+        case AST::NodeType::Return: {
+            auto* ret = static_cast<AST::Return*>(node);
+            if (ret->expr) {
+                CompileExpr(ret->expr.get());
+            } else {
+                emitter_.MovImm32(X86::RAX, 0);
+            }
+            emitter_.Jmp(return_label_);
+            break;
+        }
+        case AST::NodeType::VarDef: {
+            auto* def = static_cast<AST::VarDef*>(node);
+            emitter_.StoreImm32(X86::RBP, SlotOffset(def->ref.index) + 4, 1);
+            SetInitialized(def->ref.index, false);
+            break;
+        }
+        case AST::NodeType::While: {
+            // The condition is tested at the bottom so each iteration takes
+            // a single branch.
+            auto* loop = static_cast<AST::While*>(node);
+            auto body_label = emitter_.NewLabel();
+            auto cond_label = emitter_.NewLabel();
+            emitter_.Jmp(cond_label);
+
+            emitter_.Bind(body_label);
+            auto before = initialized_;
+            CompileBlock(loop->body);
+            initialized_ = before;
+
+            emitter_.Bind(cond_label);
+            CompileBranch(loop->condition.get(), body_label, true);
+            break;
+        }
+        default:
+            CompileExpr(node);
+    }
+}
+
+void JitCompiler::CompileExpr(AST::ASTNode* node) {
+    switch (node->node_type) {
+        case AST::NodeType::ArithOp: {
+            auto* op = static_cast<AST::ArithOp*>(node);
+            CompileBinary(op->lhs.get(), op->rhs.get());
+            switch (op->op) {
+                case AST::Operator::Add:
+                    emitter_.Add32(X86::RAX, X86::RCX);
+                    break;
+                case AST::Operator::Sub:
+                    emitter_.Sub32(X86::RAX, X86::RCX);
+                    break;
+                case AST::Operator::Mul:
+                    emitter_.Imul32(X86::RAX, X86::RCX);
+                    break;
+                case AST::Operator::Div:
+                case AST::Operator::Mod: {
+                    bool nonzero_literal =
+                        op->rhs->node_type == AST::NodeType::Integer &&
+                        static_cast<AST::Integer*>(op->rhs.get())->value != 0;
+                    if (!nonzero_literal) {
+                        emitter_.Test32(X86::RCX, X86::RCX);
+                        FailIf(X86::Equal, node, kDivisionByZero);
+                    }
+                    emitter_.Cdq();
+                    emitter_.Idiv32(X86::RCX);
+                    if (op->op == AST::Operator::Mod) {
+                        emitter_.Mov32(X86::RAX, X86::RDX);
+                    }
+                    break;
+                }
+                default:
+                    throw std::runtime_error(
+                        "Unknown arith op: " +
+                        std::string(AST::ToString(op->op)));
+            }
+            break;
+        }
+        case AST::NodeType::ArrayAccess: {
+            auto* access = static_cast<AST::ArrayAccess*>(node);
+            CompileExpr(access->index.get());
+            emitter_.Mov32(X86::RCX, X86::RAX);
+            if (!access->check_bounds) {
+                LoadArrayData(access->ref, X86::RDX, node);
+                emitter_.LoadIndexed32(X86::RAX, X86::RDX, X86::RCX);
+                break;
+            }
+            LoadArray(access->ref, X86::RDX, node);
+            emitter_.Mov64(X86::RDI, kError);
+            emitter_.MovImm64(X86::RSI, reinterpret_cast<uint64_t>(node));
+            CallHelper(reinterpret_cast<uint64_t>(&JitArrayLoad));
+            emitter_.Test64(X86::RAX, X86::RAX);
+            emitter_.Jcc(X86::Sign, error_label_);
+            break;
+        }
+        case AST::NodeType::BoolLiteral:
+            emitter_.MovImm32(X86::RAX,
+                              static_cast<AST::BoolLiteral*>(node)->value);
+            break;
+        case AST::NodeType::Integer:
+            emitter_.MovImm32(X86::RAX,
+                              static_cast<AST::Integer*>(node)->value);
+            break;
+        case AST::NodeType::LogicOp: {
+            auto* op = static_cast<AST::LogicOp*>(node);
+            CompileCompare(op);
+            emitter_.SetccEax(Condition(op));
+            break;
+        }
+        case AST::NodeType::Var: {
+            auto* var = static_cast<AST::Var*>(node);
+            if (var->ref.IsGlobal()) {
+                auto* global = Global(var->ref.index);
+                emitter_.MovImm64(X86::RCX, reinterpret_cast<uint64_t>(global));
+                emitter_.CmpImm8Byte(X86::RCX, Value::TagOffset(), 0);
+                FailIf(X86::Equal, node, kUninitialized);
+                emitter_.Load32(X86::RAX, X86::RCX, Value::PayloadOffset());
+                break;
+            }
+            if (!IsInitialized(var->ref.index)) {
+                emitter_.CmpImm8Dword(X86::RBP, SlotOffset(var->ref.index) + 4,
+                                      0);
+                FailIf(X86::NotEqual, node, kUninitialized);
+            }
+            emitter_.Load32(X86::RAX, X86::RBP, SlotOffset(var->ref.index));
+            break;
+        }
+        default:
+            throw std::runtime_error("jit: unsupported node");
+    }
+}
+
+void JitCompiler::CompileBranch(AST::ASTNode* cond, Emitter::Label label,
+                                bool jump_if) {
+    if (cond->node_type == AST::NodeType::BoolLiteral) {
+        if (static_cast<AST::BoolLiteral*>(cond)->value == jump_if) {
+            emitter_.Jmp(label);
+        }
+        return;
+    }
+
+    if (cond->node_type == AST::NodeType::LogicOp) {
+        auto* op = static_cast<AST::LogicOp*>(cond);
+        CompileCompare(op);
+        auto condition = Condition(op);
+        emitter_.Jcc(jump_if ? condition : X86::Negate(condition), label);
+        return;
+    }
+
+    CompileExpr(cond);
+    emitter_.Test32(X86::RAX, X86::RAX);
+    emitter_.Jcc(jump_if ? X86::NotEqual : X86::Equal, label);
+}
+
+void JitCompiler::CompileCompare(AST::LogicOp* node) {
+    CompileBinary(node->lhs.get(), node->rhs.get());
+    emitter_.Cmp32(X86::RAX, X86::RCX);
+}
+
+void JitCompiler::CompileBinary(AST::ASTNode* lhs, AST::ASTNode* rhs) {
+    if (rhs->node_type == AST::NodeType::Integer) {
+        CompileExpr(lhs);
+        emitter_.MovImm32(X86::RCX, static_cast<AST::Integer*>(rhs)->value);
+        return;
+    }
+
+    CompileExpr(lhs);
+    emitter_.Push(X86::RAX);
+    ++depth_;
+    CompileExpr(rhs);
+    emitter_.Mov32(X86::RCX, X86::RAX);
+    emitter_.Pop(X86::RAX);
+    --depth_;
+}
+
+void JitCompiler::LoadArray(const AST::VarRef& ref, Reg reg,
+                            AST::ASTNode* node) {
+    if (ref.IsGlobal()) {
+        // Read from the global on every access: assigning another array to
+        // it replaces the object, and may free the old one. ArrayObject
+        // derives only from Object, so both pointers are the same.
+        emitter_.MovImm64(reg, reinterpret_cast<uint64_t>(Global(ref.index)));
+        emitter_.Load64(reg, reg, Value::ObjectOffset());
+    } else {
+        emitter_.Load64(reg, X86::RBP, SlotOffset(ref.index));
+        // Other local arrays are set by their ArrayDeclaration.
+        if (ref.index >= param_count_) return;
+    }
+    // Globals and parameters declared without a size hold no array.
+    emitter_.Test64(reg, reg);
+    FailIf(X86::Equal, node, kNotArray);
+}
+
+void JitCompiler::LoadArrayData(const AST::VarRef& ref, Reg reg,
+                                AST::ASTNode* node) {
+    LoadArray(ref, reg, node);
+    emitter_.Load64(reg, reg, ArrayObject::DataOffset());
+}
+
+void JitCompiler::CallHelper(uint64_t function) {
+    bool misaligned = depth_ % 2 != 0;
+    if (misaligned) emitter_.SubRsp(8);
+    emitter_.MovImm64(X86::RAX, function);
+    emitter_.Call(X86::RAX);
+    if (misaligned) emitter_.AddRsp(8);
+}
+
+void JitCompiler::FailIf(X86::Cond cond, AST::ASTNode* node, int kind) {
+    auto label = emitter_.NewLabel();
+    emitter_.Jcc(cond, label);
+    stubs_.push_back({label, node, kind});
+}
+
+int32_t JitCompiler::SlotOffset(int index) const {
+    return -kSavedRegisters - 8 * (index + 1);
+}
+
+bool JitCompiler::IsInitialized(int slot) const {
+    return slot < static_cast<int>(initialized_.size()) && initialized_[slot];
+}
+
+void JitCompiler::SetInitialized(int slot, bool value) {
+    if (slot >= static_cast<int>(initialized_.size())) {
+        initialized_.resize(slot + 1, false);
+    }
+    initialized_[slot] = value;
+}
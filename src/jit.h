@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ast/ast.h"
+#include "ast/var_ref.h"
+#include "value.h"
+#include "x86_emitter.h"
+
+// Error reported by native code; the interpreter rethrows it as a located
+// runtime error.
+struct JitError {
+    const AST::ASTNode* node = nullptr;
+    std::string message;
+};
+
+// Machine code of one function in an executable mapping. The code runs
+// in the interpreter frame of the call: parameters are read from it and
+// local arrays are stored in it, so popping the frame releases them.
+class JitFunction {
+   public:
+    // Returns the zero-extended int or bool result, or a negative value
+    // after filling error.
+    using Entry = int64_t (*)(Value* frame, JitError* error);
+
+    explicit JitFunction(const std::vector<uint8_t>& code);
+    ~JitFunction();
+
+    JitFunction(const JitFunction&) = delete;
+    JitFunction& operator=(const JitFunction&) = delete;
+
+    int64_t Call(Value* frame, JitError* error) const {
+        return entry_(frame, error);
+    }
+
+   private:
+    void* memory_ = nullptr;
+    size_t size_ = 0;
+    Entry entry_ = nullptr;
+};
+
+// Compiles leaf functions working on ints, bools and int arrays to x86-64.
+// Scalars live in native stack slots. Array accesses proven in bounds index
+// the flat element buffer directly; the others go through helpers so their
+// errors match the interpreter exactly.
+class JitCompiler {
+   public:
+    explicit JitCompiler(Value* globals) : globals_(globals) {}
+
+    // Whether this build can generate native code at all.
+    static bool IsSupported();
+
+    // Returns nullptr when the function calls other functions, prints,
+    // uses rand or strings, declares an array variable without a size, or
+    // the platform is not supported.
+    std::unique_ptr<JitFunction> Compile(AST::Function* node);
+
+   private:
+    static bool CanCompile(AST::Function* node);
+    static bool CanCompile(AST::ASTNode* node);
+
+    void CompileStmt(AST::ASTNode* node);
+    void CompileBlock(const AST::Statements& stmts);
+    void CompileExpr(AST::ASTNode* node);
+    void CompileBranch(AST::ASTNode* cond, X86::Emitter::Label label,
+                       bool jump_if);
+    void CompileCompare(AST::LogicOp* node);
+    void CompileBinary(AST::ASTNode* lhs, AST::ASTNode* rhs);
+
+    // Loads the ArrayObject of ref into reg, failing at node when the
+    // variable holds no array.
+    void LoadArray(const AST::VarRef& ref, X86::Reg reg, AST::ASTNode* node);
+    // Loads the element buffer of the array of ref into reg.
+    void LoadArrayData(const AST::VarRef& ref, X86::Reg reg,
+                       AST::ASTNode* node);
+    // Calls a C++ helper keeping rsp 16-byte aligned.
+    void CallHelper(uint64_t function);
+    // Jumps to a stub reporting kind at node when the condition holds.
+    void FailIf(X86::Cond cond, AST::ASTNode* node, int kind);
+
+    int32_t SlotOffset(int index) const;
+    Value* Global(int index) const { return globals_ + index; }
+
+    bool IsInitialized(int slot) const;
+    void SetInitialized(int slot, bool value);
+
+    struct Stub {
+        X86::Emitter::Label label;
+        const AST::ASTNode* node;
+        int kind;
+    };
+
+    Value* globals_;
+
+    X86::Emitter emitter_;
+    X86::Emitter::Label return_label_ = -1;
+    X86::Emitter::Label error_label_ = -1;
+    // 8-byte words pushed below the fixed part of the native frame.
+    int depth_ = 0;
+    int param_count_ = 0;
+    std::vector<Stub> stubs_;
+    std::vector<bool> initialized_;
+};
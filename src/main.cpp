@@ -1,11 +1,25 @@
-﻿#include <cassert>
+﻿#include <unistd.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
 #include <deque>
+#include <fstream>
 #include <iostream>
+#include <optional>
+#include <sstream>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 #include <typeinfo>
 #include <unordered_set>
+#include <vector>
 
 #include "ast/arithmetic_op.h"
+#include "asm_generator.h"
 #include "ast/array.h"
 #include "ast/assign.h"
 #include "ast/ast.h"
@@ -22,22 +36,228 @@
 #include "ast/type.h"
 #include "ast/var.h"
 #include "ast/while.h"
+#include "backend.h"
+#include "batch_runner.h"
 #include "driver.h"
+#include "inliner.h"
 #include "interpreter.h"
+#include "output_buffer.h"
 #include "parser.hpp"
 #include "pretty_print_visitor.h"
 #include "print_visitor.h"
+#include "sampling_profiler.h"
 #include "scanner.h"
 #include "semantic_visitor.h"
 
-int main() {
+// Most worker threads --jobs accepts; more only adds scheduling overhead.
+constexpr long long kMaxJobs = 1024;
+
+// Runs the programs listed in the manifest at path and prints their
+// output in manifest order.
+int RunBatch(const std::string& path, BatchRunner::Options options) {
+    std::vector<std::string> paths;
+    try {
+        paths = ReadManifest(path);
+    } catch (const std::exception& ex) {
+        std::cerr << ex.what() << '\n';
+        return 1;
+    }
+
+    int res = 0;
+    for (const auto& result : BatchRunner(options).Run(paths)) {
+        std::cout << "=== " << result.path;
+        if (result.failed) {
+            std::cout << " (failed)\n";
+            res = 1;
+        } else {
+            std::cout << " (exit " << result.exit_code << ")\n";
+        }
+        std::cout << result.output;
+        if (!result.output.empty() && result.output.back() != '\n') {
+            std::cout << '\n';
+        }
+        if (!result.diagnostics.empty()) {
+            std::cerr << result.path << ":\n" << result.diagnostics;
+        }
+    }
+    return res;
+}
+
+int main(int argc, char* argv[]) {
+    Backend backend = Backend::TreeWalker;
+    bool emit_asm = false;
+    bool report_dead_code = false;
+    bool print_stats = false;
+    std::optional<SamplingProfiler::Mode> profiler_mode;
+    int profile_period = 0;
+    std::string profile_path;
+    std::string ir_cache_path;
+    std::string batch_path;
+    size_t jobs = 0;
+    std::optional<uint64_t> seed;
+    int inline_budget = Inliner::kDefaultBudget;
+    auto flush_policy = OutputBuffer::FlushPolicy::Frame;
+    size_t flush_threshold = OutputBuffer::kCapacity;
+    std::string input_path;
+    std::string output_path;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg(argv[i]);
+        if (arg.rfind("--backend=", 0) == 0) {
+            auto parsed = ParseBackend(arg.substr(arg.find('=') + 1));
+            if (!parsed) {
+                std::cerr << "Unknown backend: " << arg << '\n';
+                return 1;
+            }
+            backend = *parsed;
+        } else if (arg.rfind("--flush=", 0) == 0) {
+            auto parsed = ParseFlushPolicy(arg.substr(arg.find('=') + 1));
+            if (!parsed) {
+                std::cerr << "Unknown flush policy: " << arg << '\n';
+                return 1;
+            }
+            flush_policy = *parsed;
+        } else if (arg.rfind("--flush-threshold=", 0) == 0) {
+            const char* value = argv[i] + arg.find('=') + 1;
+            char* end = nullptr;
+            long long parsed = std::strtoll(value, &end, 10);
+            if (end == value || *end != '\0' || parsed <= 0 ||
+                parsed > static_cast<long long>(OutputBuffer::kCapacity)) {
+                std::cerr << "Flush threshold must be in 1.."
+                          << OutputBuffer::kCapacity << ": " << arg << '\n';
+                return 1;
+            }
+            flush_threshold = parsed;
+        } else if (arg == "--emit=asm") {
+            emit_asm = true;
+        } else if (arg.rfind("--inline-budget=", 0) == 0) {
+            const char* value = argv[i] + arg.find('=') + 1;
+            char* end = nullptr;
+            long long parsed = std::strtoll(value, &end, 10);
+            if (end == value || *end != '\0' || parsed < 0 ||
+                parsed > INT_MAX) {
+                std::cerr << "Inline budget must be in 0.." << INT_MAX
+                          << ": " << arg << '\n';
+                return 1;
+            }
+            inline_budget = parsed;
+        } else if (arg == "--report-dead-code") {
+            report_dead_code = true;
+        } else if (arg.rfind("--batch=", 0) == 0) {
+            batch_path = arg.substr(arg.find('=') + 1);
+        } else if (arg.rfind("--jobs=", 0) == 0) {
+            const char* value = argv[i] + arg.find('=') + 1;
+            char* end = nullptr;
+            long long parsed = std::strtoll(value, &end, 10);
+            if (end == value || *end != '\0' || parsed < 0 ||
+                parsed > kMaxJobs) {
+                std::cerr << "Jobs must be in 0.." << kMaxJobs << ": " << arg
+                          << '\n';
+                return 1;
+            }
+            jobs = parsed;
+        } else if (arg.rfind("--seed=", 0) == 0) {
+            // strtoull skips spaces and negates a leading '-'; both are
+            // rejected by requiring a digit first.
+            const char* value = argv[i] + arg.find('=') + 1;
+            char* end = nullptr;
+            errno = 0;
+            unsigned long long parsed = std::strtoull(value, &end, 10);
+            if (*value < '0' || *value > '9' || *end != '\0' ||
+                errno == ERANGE) {
+                std::cerr << "Seed must be in 0.."
+                          << UINT64_MAX << ": " << arg << '\n';
+                return 1;
+            }
+            seed = parsed;
+        } else if (arg.rfind("--ir-cache=", 0) == 0) {
+            ir_cache_path = arg.substr(arg.find('=') + 1);
+        } else if (arg == "--stats") {
+            print_stats = true;
+        } else if (arg.rfind("--profile=", 0) == 0) {
+            profiler_mode = ParseProfilerMode(arg.substr(arg.find('=') + 1));
+            if (!profiler_mode) {
+                std::cerr << "Unknown profiler mode: " << arg << '\n';
+                return 1;
+            }
+        } else if (arg.rfind("--profile-period=", 0) == 0) {
+            const char* value = argv[i] + arg.find('=') + 1;
+            char* end = nullptr;
+            long long parsed = std::strtoll(value, &end, 10);
+            if (end == value || *end != '\0' || parsed < 0 ||
+                parsed > SamplingProfiler::kMaxPeriod) {
+                std::cerr << "Profile period must be in 0.."
+                          << SamplingProfiler::kMaxPeriod << ": " << arg
+                          << '\n';
+                return 1;
+            }
+            profile_period = parsed;
+        } else if (arg.rfind("--profile-output=", 0) == 0) {
+            profile_path = arg.substr(arg.find('=') + 1);
+        } else if (arg == "-o" && i + 1 < argc) {
+            output_path = argv[++i];
+        } else if (arg.size() > 1 && arg[0] == '-') {
+            std::cerr << "Unknown option: " << arg << '\n';
+            return 1;
+        } else {
+            input_path = arg;
+        }
+    }
+
+    if (!batch_path.empty()) {
+        return RunBatch(batch_path, {backend, inline_budget, jobs, seed});
+    }
+
     Driver driver;
+    driver.SetInlineBudget(inline_budget);
+    driver.SetJobs(jobs);
+    if (seed) driver.SetSeed(*seed);
+    if (print_stats) driver.EnableStats();
+    if (!ir_cache_path.empty()) driver.SetIRCache(ir_cache_path);
 
-    auto res = driver.Run(std::cin);
+    int res = 0;
+    if (input_path.empty()) {
+        res = driver.Run(std::cin);
+    } else {
+        try {
+            res = driver.RunFile(input_path);
+        } catch (const std::exception& ex) {
+            std::cerr << ex.what() << '\n';
+            return 1;
+        }
+    }
     if (res) return res;
 
+    if (report_dead_code) {
+        for (const auto& dead : driver.GetDeadCode()) {
+            std::cerr << dead << '\n';
+        }
+    }
+
     auto ir = driver.GetIR();
 
+    if (emit_asm) {
+        // The output file is only touched once the program is generated.
+        std::ostringstream assembly;
+        try {
+            AsmGenerator(ir, assembly).Generate();
+        } catch (const std::exception& ex) {
+            std::cerr << "\033[31mCodegen error: " << ex.what() << "\033[0m\n";
+            return 1;
+        }
+        if (output_path.empty()) {
+            std::cout << assembly.str();
+            return 0;
+        }
+        std::ofstream output_file(output_path);
+        if (!output_file) {
+            std::cerr << "Cannot open " << output_path << '\n';
+            return 1;
+        }
+        output_file << assembly.str();
+        return 0;
+    }
+
     std::cout << "\n\n";
 
     PrintVisitor print_visitor(std::cout);
@@ -48,15 +268,33 @@ int main() {
     PrettyPrintVisitor pretty_print_visitor(std::cout);
     ir.GetAST()->accept(&pretty_print_visitor);
 
-    std::cout << "\n\n";
+    // The program writes to the descriptor directly, after the tree.
+    std::cout << "\n\n" << std::flush;
 
-    Interpreter interpreter(ir, std::cout);
+    std::optional<SamplingProfiler> profiler;
+    if (profiler_mode) profiler.emplace(*profiler_mode, profile_period);
 
     try {
-        interpreter.Exec();
+        OutputBuffer output(STDOUT_FILENO, flush_policy, flush_threshold);
+        driver.Execute(backend, output, profiler ? &*profiler : nullptr);
+        output.Flush();
     } catch (const std::exception& ex) {
         std::cout << "\033[31mInterpreter error: " << ex.what() << "\033[0m\n";
     }
 
+    if (print_stats) std::cerr << driver.GetStats();
+
+    if (profiler) {
+        profiler->WriteReport(std::cerr);
+        if (!profile_path.empty()) {
+            std::ofstream profile_file(profile_path);
+            if (!profile_file) {
+                std::cerr << "Cannot open " << profile_path << '\n';
+                return 1;
+            }
+            profiler->WriteCollapsed(profile_file);
+        }
+    }
+
     return 0;
 }
@@ -0,0 +1,100 @@
+#include "output_buffer.h"
+
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+constexpr std::string_view kClearScreen = "\033[2J";
+
+}  // namespace
+
+OutputBuffer::OutputBuffer(int fd, FlushPolicy policy, size_t threshold)
+    : fd_(fd),
+      policy_(policy),
+      threshold_(threshold),
+      data_(new char[kCapacity]) {}
+
+OutputBuffer::OutputBuffer(std::ostream& os, FlushPolicy policy,
+                           size_t threshold)
+    : os_(&os), policy_(policy), threshold_(threshold),
+      data_(new char[kCapacity]) {}
+
+OutputBuffer::~OutputBuffer() {
+    // Nothing can be reported from here; Flush before to see errors.
+    try {
+        Flush();
+    } catch (const std::exception&) {
+    }
+}
+
+void OutputBuffer::Write(std::string_view text) {
+    if (policy_ == FlushPolicy::Frame &&
+        text.substr(0, kClearScreen.size()) == kClearScreen) {
+        Flush();
+    }
+
+    if (size_ + text.size() > kCapacity) {
+        Flush();
+        // Too large to buffer: pass it through in one write.
+        if (text.size() >= kCapacity) {
+            WriteOut(text.data(), text.size());
+            return;
+        }
+    }
+    std::memcpy(data_.get() + size_, text.data(), text.size());
+    size_ += text.size();
+    if (policy_ == FlushPolicy::Threshold && size_ >= threshold_) Flush();
+}
+
+void OutputBuffer::WriteInt(int32_t value) {
+    char digits[12];
+    char* end = digits + sizeof(digits);
+    char* begin = end;
+    // Negated as unsigned so that INT32_MIN does not overflow.
+    uint32_t magnitude = value < 0 ? 0u - static_cast<uint32_t>(value)
+                                   : static_cast<uint32_t>(value);
+    do {
+        *--begin = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude);
+    if (value < 0) *--begin = '-';
+    Write({begin, static_cast<size_t>(end - begin)});
+}
+
+void OutputBuffer::Flush() {
+    if (size_ == 0) return;
+    size_t size = size_;
+    size_ = 0;
+    WriteOut(data_.get(), size);
+}
+
+void OutputBuffer::WriteOut(const char* data, size_t size) {
+    ++flush_count_;
+    if (os_) {
+        os_->write(data, size);
+        return;
+    }
+    while (size > 0) {
+        ssize_t written = write(fd_, data, size);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error(std::string("Cannot write output: ") +
+                                     std::strerror(errno));
+        }
+        data += written;
+        size -= written;
+    }
+}
+
+std::optional<OutputBuffer::FlushPolicy> ParseFlushPolicy(
+    std::string_view name) {
+    if (name == "frame") return OutputBuffer::FlushPolicy::Frame;
+    if (name == "threshold") return OutputBuffer::FlushPolicy::Threshold;
+    if (name == "exit") return OutputBuffer::FlushPolicy::Exit;
+    return std::nullopt;
+}
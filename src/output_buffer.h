@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string_view>
+
+// Sink for the output of print. Text and integers are formatted into a
+// large user-space buffer, without going through iostream and its locale,
+// and handed to write(2) in bulk. A buffer is always flushed when full and
+// when destroyed; the policy adds the flush points in between.
+class OutputBuffer {
+   public:
+    enum class FlushPolicy {
+        // Before a clear-screen escape, so an animation that redraws the
+        // screen is shown one whole frame at a time.
+        Frame,
+        // Whenever the buffered size reaches the threshold.
+        Threshold,
+        // Only when the buffer is full and at exit.
+        Exit,
+    };
+
+    static constexpr size_t kCapacity = 64 * 1024;
+
+    // Writes to the file descriptor, which stays open.
+    explicit OutputBuffer(int fd, FlushPolicy policy = FlushPolicy::Frame,
+                          size_t threshold = kCapacity);
+    // Writes to the stream, for callers that capture the output.
+    explicit OutputBuffer(std::ostream& os,
+                          FlushPolicy policy = FlushPolicy::Exit,
+                          size_t threshold = kCapacity);
+    ~OutputBuffer();
+
+    OutputBuffer(const OutputBuffer&) = delete;
+    OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+    void Write(std::string_view text);
+    void WriteInt(int32_t value);
+    void WriteBool(bool value) { Append(value ? '1' : '0'); }
+
+    // Throws std::runtime_error if the descriptor cannot be written.
+    void Flush();
+
+    size_t Buffered() const { return size_; }
+    // Number of write(2) calls or stream writes made so far.
+    size_t FlushCount() const { return flush_count_; }
+
+   private:
+    void Append(char c) {
+        if (size_ == kCapacity) Flush();
+        data_[size_++] = c;
+        if (policy_ == FlushPolicy::Threshold && size_ >= threshold_) {
+            Flush();
+        }
+    }
+
+    void WriteOut(const char* data, size_t size);
+
+    int fd_ = -1;
+    std::ostream* os_ = nullptr;
+    FlushPolicy policy_;
+    size_t threshold_;
+
+    std::unique_ptr<char[]> data_;
+    size_t size_ = 0;
+    size_t flush_count_ = 0;
+};
+
+std::optional<OutputBuffer::FlushPolicy> ParseFlushPolicy(
+    std::string_view name);
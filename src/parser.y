@@ -11,11 +11,13 @@
 {
     #include <iostream>
     #include <string>
+    #include <string_view>
     #include <vector>
     #include <stdint.h>
     #include "ast/ast.h"
     #include "ast/type.h"
     #include "ast/name_type.h"
+    #include "ast/symbol.h"
 
     using namespace std;
 
@@ -40,7 +42,7 @@
     
     // yylex() arguments are defined in parser.y
     static EzAquarii::Parser::symbol_type yylex(EzAquarii::Scanner &scanner) {
-        return scanner.get_next_token();
+        return scanner.NextToken();
     }
     
     // you can accomplish the same thing by inlining the code using preprocessor
@@ -74,11 +76,11 @@
 %token LESS GREATER;
 %token IF ELSE;
 %token WHILE;
-%token <std::string> ID
+%token <AST::Symbol> ID
 %token VOID INT BOOL
 %token PRINT
 %token RETURN
-%token <std::string> STRING
+%token <std::string_view> STRING
 %token <bool> TRUE FALSE
 %token RAND
 
@@ -278,14 +280,14 @@ literal:
 expr:
     LEFTPAR expr RIGHTPAR { $$ = $2; }
     | function_call { $$ = $1; }
-    | expr PLUS expr { $$ = driver.with_location(driver.make_arith_op("+", $1, $3), @2); }
-    | expr MINUS expr { $$ = driver.with_location(driver.make_arith_op("-", $1, $3), @2); }
-    | expr MULTIPLY expr { $$ = driver.with_location(driver.make_arith_op("*", $1, $3), @2); }
-    | expr DIVIDE expr { $$ = driver.with_location(driver.make_arith_op("/", $1, $3), @2); }
-    | expr MOD expr { $$ = driver.with_location(driver.make_arith_op("%", $1, $3), @2); }
-    | expr LESS expr { $$ = driver.with_location(driver.make_logic_op("<", $1, $3), @2); }
-    | expr GREATER expr { $$ = driver.with_location(driver.make_logic_op(">", $1, $3), @2); }
-    | expr EQUAL expr { $$ = driver.with_location(driver.make_logic_op("==", $1, $3), @2); }
+    | expr PLUS expr { $$ = driver.with_location(driver.make_arith_op(AST::Operator::Add, $1, $3), @2); }
+    | expr MINUS expr { $$ = driver.with_location(driver.make_arith_op(AST::Operator::Sub, $1, $3), @2); }
+    | expr MULTIPLY expr { $$ = driver.with_location(driver.make_arith_op(AST::Operator::Mul, $1, $3), @2); }
+    | expr DIVIDE expr { $$ = driver.with_location(driver.make_arith_op(AST::Operator::Div, $1, $3), @2); }
+    | expr MOD expr { $$ = driver.with_location(driver.make_arith_op(AST::Operator::Mod, $1, $3), @2); }
+    | expr LESS expr { $$ = driver.with_location(driver.make_logic_op(AST::Operator::Less, $1, $3), @2); }
+    | expr GREATER expr { $$ = driver.with_location(driver.make_logic_op(AST::Operator::Greater, $1, $3), @2); }
+    | expr EQUAL expr { $$ = driver.with_location(driver.make_logic_op(AST::Operator::Equal, $1, $3), @2); }
     | ID { $$ = driver.with_location(driver.make_var($1), @1); }
     | ID LEFTBRACKET expr RIGHTBRACKET { $$ = driver.with_location(driver.make_array_access($1, $3), @2); }
     | literal
@@ -296,5 +298,5 @@ expr:
 
 // Bison expects us to provide implementation - otherwise linker complains
 void EzAquarii::Parser::error([[maybe_unused]] const location &loc , const std::string &message) {	
-    cout << "Error: " << message << endl << "Error location: " << driver.get_location() << endl;
+    driver.diagnostics() << "Error: " << message << endl << "Error location: " << driver.get_location() << endl;
 }
@@ -29,6 +29,7 @@
 #include "parser_driver.h"
 
 #include <algorithm>
+#include <iterator>
 #include <sstream>
 
 #include "ast/arithmetic_op.h"
@@ -61,14 +62,24 @@ ParserDriver::ParserDriver()
 
 int ParserDriver::parse() {
     // parser_.set_debug_level(1);
+    node_count_ = 0;
     return parser_.parse();
 }
 
 void ParserDriver::switchInputStream(std::istream* is) {
-    scanner_.switch_streams(is, NULL);
+    buffer_.assign(std::istreambuf_iterator<char>(*is), {});
+    switchInputBuffer(buffer_);
+}
+
+void ParserDriver::switchInputBuffer(std::string_view source) {
+    source_ = source;
+    offset_ = 0;
+    scanner_.SetInput(source);
 }
 
 void ParserDriver::ScannerAction(unsigned int length, std::string_view text) {
+    token_ = source_.substr(offset_, length);
+    offset_ += length;
     loc_.step();
     loc_.columns(length);
     if (scanner_debug_level_ > 0) {
@@ -94,15 +105,13 @@ std::shared_ptr<AST::ASTNode> ParserDriver::GetAST() { return ast_; }
 std::shared_ptr<ASTNode> ParserDriver::make_program(
     std::shared_ptr<Statements> top_level_list) {
     ParserLog("create ast program ", '\n');
-    auto node = std::make_shared<Program>();
-    for (auto top_level : *top_level_list) {
-        node->globals.push_back(top_level);
-    }
+    auto node = Make<Program>();
+    node->globals = std::move(*top_level_list);
     return node;
 }
 
 std::shared_ptr<Statements> ParserDriver::make_empty_top_level_list() {
-    return std::make_shared<Statements>();
+    return Make<Statements>();
 }
 
 std::shared_ptr<Statements> ParserDriver::append_top_level(
@@ -117,23 +126,23 @@ std::shared_ptr<Statements> ParserDriver::append_top_level(
 }
 
 std::shared_ptr<ASTNode> ParserDriver::make_function(
-    Type return_type, const std::string& name, std::shared_ptr<Params> params,
+    Type return_type, Symbol name, std::shared_ptr<Params> params,
     std::shared_ptr<Statements> list) {
     ParserLog("create ast function ", name, '\n');
-    auto node = std::make_shared<Function>();
+    auto node = Make<Function>();
 
     node->return_type = return_type;
     node->name = name;
-    node->args = *params;
-    node->body = *list;
+    node->args = std::move(*params);
+    node->body = std::move(*list);
 
     return node;
 }
 
 std::shared_ptr<ASTNode> ParserDriver::make_function_call(
-    const std::string& name, std::shared_ptr<Statements> args) {
+    Symbol name, std::shared_ptr<Statements> args) {
     ParserLog("create ast function call ", name, '\n');
-    auto node = std::make_shared<FunCall>();
+    auto node = Make<FunCall>();
 
     node->name = name;
 
@@ -152,7 +161,7 @@ std::shared_ptr<ASTNode> ParserDriver::make_function_call(
 
 std::shared_ptr<Statements> ParserDriver::make_empty_arg_list() {
     ParserLog("call ast ParserDriver::make_empty_arg_list", '\n');
-    return std::make_shared<Statements>();
+    return Make<Statements>();
 }
 
 std::shared_ptr<Statements> ParserDriver::make_arg_list(
@@ -176,7 +185,7 @@ std::shared_ptr<Statements> ParserDriver::append_arg(
 
 std::shared_ptr<Statements> ParserDriver::make_empty_stmt_list() {
     ParserLog("call ast ParserDriver::make_empty_stmt_list", '\n');
-    return std::make_shared<Statements>();
+    return Make<Statements>();
 }
 
 std::shared_ptr<Statements> ParserDriver::append_stmt(
@@ -192,11 +201,10 @@ std::shared_ptr<Statements> ParserDriver::append_stmt(
 
 std::shared_ptr<Params> ParserDriver::make_empty_param_list() {
     ParserLog("call ast ParserDriver::make_empty_param_list", '\n');
-    return std::make_shared<Params>();
+    return Make<Params>();
 }
 
-std::shared_ptr<Params> ParserDriver::make_param_list(Type type,
-                                                      const std::string& name) {
+std::shared_ptr<Params> ParserDriver::make_param_list(Type type, Symbol name) {
     ParserLog("call ast ParserDriver::make_param_list", '\n');
     auto params = ParserDriver::make_empty_param_list();
     params->push_back({name, type});
@@ -204,7 +212,7 @@ std::shared_ptr<Params> ParserDriver::make_param_list(Type type,
 }
 
 std::shared_ptr<Params> ParserDriver::append_param(
-    std::shared_ptr<Params> params, Type type, const std::string& name) {
+    std::shared_ptr<Params> params, Type type, Symbol name) {
     ParserLog("call ast append_param, params initialized: ",
               static_cast<bool>(params), '\n');
     if (!params) {
@@ -217,7 +225,7 @@ std::shared_ptr<Params> ParserDriver::append_param(
 std::shared_ptr<ASTNode> ParserDriver::make_return(
     std::shared_ptr<ASTNode> expr) {
     ParserLog("create ast return ", '\n');
-    auto node = std::make_shared<Return>();
+    auto node = Make<Return>();
     if (expr) {
         node->expr = std::dynamic_pointer_cast<Expr>(expr);
         if (!node->expr) {
@@ -229,13 +237,12 @@ std::shared_ptr<ASTNode> ParserDriver::make_return(
 
 std::shared_ptr<AST::ASTNode> ParserDriver::make_rand() {
     ParserLog("create ast rand ", '\n');
-    return std::make_shared<Rand>();
+    return Make<Rand>();
 }
 
-std::shared_ptr<ASTNode> ParserDriver::make_decl(Type type,
-                                                 const std::string& name) {
+std::shared_ptr<ASTNode> ParserDriver::make_decl(Type type, Symbol name) {
     ParserLog("create ast decl ", name, '\n');
-    auto node = std::make_shared<VarDef>();
+    auto node = Make<VarDef>();
     node->type = type;
     node->name = name;
     return node;
@@ -243,14 +250,14 @@ std::shared_ptr<ASTNode> ParserDriver::make_decl(Type type,
 
 std::shared_ptr<ASTNode> ParserDriver::make_integer(uint64_t value) {
     ParserLog("create ast integer ", value, '\n');
-    auto node = std::make_shared<Integer>(value);
+    auto node = Make<Integer>(value);
     return node;
 }
 
 std::shared_ptr<ASTNode> ParserDriver::make_assignment(
-    const std::string& var, std::shared_ptr<ASTNode> expr) {
+    Symbol var, std::shared_ptr<ASTNode> expr) {
     ParserLog("create ast assign ", var, '\n');
-    auto node = std::make_shared<Assign>();
+    auto node = Make<Assign>();
     node->var = var;
     node->expr = std::dynamic_pointer_cast<Expr>(expr);
     if (!node->expr) {
@@ -262,37 +269,37 @@ std::shared_ptr<ASTNode> ParserDriver::make_assignment(
 std::shared_ptr<ASTNode> ParserDriver::make_print(
     std::shared_ptr<ASTNode> expr) {
     ParserLog("create ast print ", '\n');
-    auto node = std::make_shared<Print>();
+    auto node = Make<Print>();
     node->expr = expr;
     return node;
 }
 
 std::shared_ptr<ASTNode> ParserDriver::make_string_literal(
-    const std::string& string) {
+    std::string_view string) {
     ParserLog("create ast string literal ", string, '\n');
-    auto node = std::make_shared<StringLiteral>();
-    node->value = string;
+    auto node = Make<StringLiteral>();
+    node->value = unescape(string);
     return node;
 }
 
 std::shared_ptr<ASTNode> ParserDriver::make_bool_literal(const bool value) {
     ParserLog("create ast bool literal ", value, '\n');
-    auto node = std::make_shared<BoolLiteral>(value);
+    auto node = Make<BoolLiteral>(value);
     return node;
 }
 
-std::shared_ptr<ASTNode> ParserDriver::make_var(const std::string& var) {
+std::shared_ptr<ASTNode> ParserDriver::make_var(Symbol var) {
     ParserLog("create ast var ", var, '\n');
-    auto node = std::make_shared<Var>();
+    auto node = Make<Var>();
     node->name = var;
     return node;
 }
 
 std::shared_ptr<ASTNode> ParserDriver::make_arith_op(
-    const std::string& op, std::shared_ptr<ASTNode> lhs,
+    Operator op, std::shared_ptr<ASTNode> lhs,
     std::shared_ptr<ASTNode> rhs) {
     ParserLog("create ast arith_op ", '\n');
-    auto node = std::make_shared<ArithOp>();
+    auto node = Make<ArithOp>();
     node->lhs = std::dynamic_pointer_cast<Expr>(lhs);
     if (!node->lhs) {
         throw std::runtime_error("lhs is not Expr node");
@@ -307,10 +314,10 @@ std::shared_ptr<ASTNode> ParserDriver::make_arith_op(
 }
 
 std::shared_ptr<ASTNode> ParserDriver::make_logic_op(
-    const std::string& op, std::shared_ptr<ASTNode> lhs,
+    Operator op, std::shared_ptr<ASTNode> lhs,
     std::shared_ptr<ASTNode> rhs) {
     ParserLog("create ast logic_op ", '\n');
-    auto node = std::make_shared<LogicOp>();
+    auto node = Make<LogicOp>();
     node->lhs = std::dynamic_pointer_cast<Expr>(lhs);
     if (!node->lhs) {
         throw std::runtime_error("lhs is not Expr node");
@@ -328,7 +335,7 @@ std::shared_ptr<ASTNode> ParserDriver::make_if(
     std::shared_ptr<ASTNode> condition, std::shared_ptr<ASTNode> then_branch,
     std::shared_ptr<ASTNode> else_branch) {
     ParserLog("create ast if_then_else ", '\n');
-    auto node = std::make_shared<IfThenElse>();
+    auto node = Make<IfThenElse>();
     node->condition = std::dynamic_pointer_cast<Expr>(condition);
     if (!node->condition) {
         throw std::runtime_error("lhs is not Expr node");
@@ -344,14 +351,14 @@ std::shared_ptr<ASTNode> ParserDriver::make_if(
     std::shared_ptr<ASTNode> condition, std::shared_ptr<Statements> then_branch,
     std::shared_ptr<Statements> else_branch) {
     ParserLog("create ast if_then_else ", '\n');
-    auto node = std::make_shared<IfThenElse>();
+    auto node = Make<IfThenElse>();
     node->condition = std::dynamic_pointer_cast<Expr>(condition);
     if (!node->condition) {
         throw std::runtime_error("lhs is not Expr node");
     }
-    node->then_branch = *then_branch;
+    node->then_branch = std::move(*then_branch);
     if (else_branch) {
-        node->else_branch = *else_branch;
+        node->else_branch = std::move(*else_branch);
     }
     return node;
 }
@@ -359,7 +366,7 @@ std::shared_ptr<ASTNode> ParserDriver::make_if(
 std::shared_ptr<ASTNode> ParserDriver::make_while(
     std::shared_ptr<ASTNode> condition, std::shared_ptr<ASTNode> statement) {
     ParserLog("create ast while ", '\n');
-    auto node = std::make_shared<While>();
+    auto node = Make<While>();
     node->condition = condition;
     node->body.push_back(statement);
     return node;
@@ -368,35 +375,35 @@ std::shared_ptr<ASTNode> ParserDriver::make_while(
 std::shared_ptr<ASTNode> ParserDriver::make_while(
     std::shared_ptr<ASTNode> condition, std::shared_ptr<Statements> list) {
     ParserLog("create ast while with block ", '\n');
-    auto node = std::make_shared<While>();
+    auto node = Make<While>();
     node->condition = condition;
-    node->body = *list;
+    node->body = std::move(*list);
     return node;
 }
 
 std::shared_ptr<ASTNode> ParserDriver::make_array_declaration(
-    const std::string& name, const Type& type) {
+    Symbol name, const Type& type) {
     ParserLog("create ast array decl ", name, '\n');
-    auto node = std::make_shared<ArrayDeclaration>();
+    auto node = Make<ArrayDeclaration>();
     node->name = name;
     node->type = type;
     return node;
 }
 
 std::shared_ptr<ASTNode> ParserDriver::make_array_access(
-    const std::string& name, std::shared_ptr<ASTNode> expr) {
+    Symbol name, std::shared_ptr<ASTNode> expr) {
     ParserLog("create ast array access ", name, '\n');
-    auto node = std::make_shared<ArrayAccess>();
+    auto node = Make<ArrayAccess>();
     node->name = name;
     node->index = expr;
     return node;
 }
 
 std::shared_ptr<ASTNode> ParserDriver::make_array_assignment(
-    const std::string& name, std::shared_ptr<ASTNode> index,
+    Symbol name, std::shared_ptr<ASTNode> index,
     std::shared_ptr<ASTNode> expr) {
     ParserLog("create ast array assignment ", name, '\n');
-    auto node = std::make_shared<ArrayAssignment>();
+    auto node = Make<ArrayAssignment>();
     node->name = name;
     node->index = index;
     node->expr = std::dynamic_pointer_cast<Expr>(expr);
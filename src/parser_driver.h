@@ -28,12 +28,18 @@
 
 #pragma once
 
+#include <iostream>
 #include <memory>
+#include <string>
 #include <string_view>
+#include <type_traits>
 #include <unordered_map>
 
+#include "ast/operator.h"
+#include "ast/symbol.h"
 #include "location.hh"
 #include "scanner.h"
+#include "stats.h"
 
 // autogenerated by Bison, don't panic
 // if your IDE can't resolve it - call make first
@@ -68,10 +74,16 @@ class ParserDriver {
 
     /**
      * Switch scanner input stream. Default is standard input (std::cin).
-     * It will also reset AST.
+     * The stream is read up front into a buffer owned by the driver.
      */
     void switchInputStream(std::istream* is);
 
+    /**
+     * Scan source in place, e.g. out of a SourceFile mapping. The caller
+     * keeps the source alive until parse() returns.
+     */
+    void switchInputBuffer(std::string_view source);
+
     /**
      * This is needed so that Scanner and Parser can call some
      * methods that we want to keep hidden from the end user.
@@ -84,6 +96,16 @@ class ParserDriver {
 
     std::shared_ptr<AST::ASTNode> GetAST();
 
+    // Stream for syntax errors; std::cout by default.
+    void SetDiagnostics(std::ostream& os) { diagnostics_ = &os; }
+
+    // Adds the cost of scanning to stats while parsing; nullptr stops it.
+    void SetScanStats(PhaseStats* stats) { scanner_.SetStats(stats); }
+
+    size_t TokenCount() const { return scanner_.TokenCount(); }
+    // AST nodes created by the last parse.
+    size_t NodeCount() const { return node_count_; }
+
    private:
     // Used internally by Scanner YY_USER_ACTION to update location indicator
     void ScannerAction(unsigned int length, std::string_view text);
@@ -93,6 +115,11 @@ class ParserDriver {
     // Used to get last Scanner location. Used in error messages.
     const location& get_location() const;
 
+    std::ostream& diagnostics() { return *diagnostics_; }
+
+    // Text of the token being scanned, as a view into the source.
+    std::string_view token_text() const { return token_; }
+
     // functions
     std::shared_ptr<AST::ASTNode> make_program(
         std::shared_ptr<AST::Statements> top_level_list);
@@ -104,12 +131,12 @@ class ParserDriver {
         std::shared_ptr<AST::ASTNode> stmt);
 
     std::shared_ptr<AST::ASTNode> make_function(
-        AST::Type return_type, const std::string& name,
+        AST::Type return_type, AST::Symbol name,
         std::shared_ptr<AST::Params> params,
         std::shared_ptr<AST::Statements> list);
 
     std::shared_ptr<AST::ASTNode> make_function_call(
-        const std::string& name, std::shared_ptr<AST::Statements> args);
+        AST::Symbol name, std::shared_ptr<AST::Statements> args);
 
     std::shared_ptr<AST::Statements> make_empty_arg_list();
 
@@ -129,41 +156,40 @@ class ParserDriver {
     std::shared_ptr<AST::Params> make_empty_param_list();
 
     std::shared_ptr<AST::Params> make_param_list(AST::Type type,
-                                                 const std::string& name);
+                                                 AST::Symbol name);
 
     std::shared_ptr<AST::Params> append_param(
         std::shared_ptr<AST::Params> params, AST::Type type,
-        const std::string& name);
+        AST::Symbol name);
 
     std::shared_ptr<AST::ASTNode> make_return(
         std::shared_ptr<AST::ASTNode> expr);
 
     std::shared_ptr<AST::ASTNode> make_rand();
 
-    std::shared_ptr<AST::ASTNode> make_decl(AST::Type type,
-                                            const std::string& name);
+    std::shared_ptr<AST::ASTNode> make_decl(AST::Type type, AST::Symbol name);
 
     std::shared_ptr<AST::ASTNode> make_integer(uint64_t value);
 
     std::shared_ptr<AST::ASTNode> make_assignment(
-        const std::string& var, std::shared_ptr<AST::ASTNode> st);
+        AST::Symbol var, std::shared_ptr<AST::ASTNode> st);
 
     std::shared_ptr<AST::ASTNode> make_print(
         std::shared_ptr<AST::ASTNode> expr);
 
     std::shared_ptr<AST::ASTNode> make_string_literal(
-        const std::string& string);
+        std::string_view string);
 
     std::shared_ptr<AST::ASTNode> make_bool_literal(const bool value);
 
-    std::shared_ptr<AST::ASTNode> make_var(const std::string& var);
+    std::shared_ptr<AST::ASTNode> make_var(AST::Symbol var);
 
     std::shared_ptr<AST::ASTNode> make_arith_op(
-        const std::string& op, std::shared_ptr<AST::ASTNode> lhs,
+        AST::Operator op, std::shared_ptr<AST::ASTNode> lhs,
         std::shared_ptr<AST::ASTNode> rhs);
 
     std::shared_ptr<AST::ASTNode> make_logic_op(
-        const std::string& op, std::shared_ptr<AST::ASTNode> lhs,
+        AST::Operator op, std::shared_ptr<AST::ASTNode> lhs,
         std::shared_ptr<AST::ASTNode> rhs);
 
     std::shared_ptr<AST::ASTNode> make_if(
@@ -185,18 +211,25 @@ class ParserDriver {
         std::shared_ptr<AST::Statements> list);
 
     std::shared_ptr<AST::ASTNode> make_array_declaration(
-        const std::string& name, const AST::Type& type);
+        AST::Symbol name, const AST::Type& type);
 
     std::shared_ptr<AST::ASTNode> make_array_access(
-        const std::string& name, std::shared_ptr<AST::ASTNode> expr);
+        AST::Symbol name, std::shared_ptr<AST::ASTNode> expr);
 
     std::shared_ptr<AST::ASTNode> make_array_assignment(
-        const std::string& name, std::shared_ptr<AST::ASTNode> index,
+        AST::Symbol name, std::shared_ptr<AST::ASTNode> index,
         std::shared_ptr<AST::ASTNode> expr);
 
     std::shared_ptr<AST::ASTNode> with_location(
         std::shared_ptr<AST::ASTNode> node, const EzAquarii::location& loc);
 
+    // Allocates a node or list, counting the nodes.
+    template <typename T, typename... Args>
+    std::shared_ptr<T> Make(Args&&... args) {
+        if constexpr (std::is_base_of_v<AST::ASTNode, T>) ++node_count_;
+        return std::make_shared<T>(std::forward<Args>(args)...);
+    }
+
     template <typename... Args>
     void ParserLog(Args... args) {
         if (parser_debug_level_ == 0) return;
@@ -207,7 +240,17 @@ class ParserDriver {
     Parser parser_;
     location loc_;
 
+    // Source being scanned and the current token within it; buffer_ holds
+    // the contents of an input stream.
+    std::string buffer_;
+    std::string_view source_;
+    size_t offset_ = 0;
+    std::string_view token_;
+
     std::shared_ptr<AST::ASTNode> ast_;
+    size_t node_count_ = 0;
+
+    std::ostream* diagnostics_ = &std::cout;
 
     int scanner_debug_level_ = 0;
     int parser_debug_level_ = 0;
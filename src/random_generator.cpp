@@ -0,0 +1,51 @@
+#include "random_generator.h"
+
+#include <random>
+
+static_assert(RAND_MAX == 0x7fffffff,
+              "rand() values are taken as 31 bits of the generator output");
+
+namespace {
+
+uint64_t RotateLeft(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+}  // namespace
+
+RandomGenerator::RandomGenerator() {
+    std::random_device device;
+    Seed((static_cast<uint64_t>(device()) << 32) | device());
+}
+
+void RandomGenerator::Seed(uint64_t seed) {
+    // SplitMix64, which never yields the all-zero state xoshiro is stuck
+    // in.
+    for (auto& word : state_) {
+        seed += 0x9e3779b97f4a7c15;
+        uint64_t z = seed;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        word = z ^ (z >> 31);
+    }
+    next_ = kBatch;
+}
+
+uint64_t RandomGenerator::NextRaw() {
+    uint64_t result = RotateLeft(state_[1] * 5, 7) * 9;
+    uint64_t t = state_[1] << 17;
+    state_[2] ^= state_[0];
+    state_[3] ^= state_[1];
+    state_[1] ^= state_[2];
+    state_[0] ^= state_[3];
+    state_[2] ^= t;
+    state_[3] = RotateLeft(state_[3], 45);
+    return result;
+}
+
+void RandomGenerator::Refill() {
+    for (size_t i = 0; i < kBatch; i += 2) {
+        uint64_t raw = NextRaw();
+        batch_[i] = static_cast<int32_t>(raw >> 33);
+        batch_[i + 1] = static_cast<int32_t>(raw & kMax);
+    }
+    next_ = 0;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+// Source of rand() for one interpreter. xoshiro256** seeded through
+// SplitMix64, so a given seed yields the same sequence on every platform.
+// Each 64-bit output provides two values in [0, RAND_MAX], generated a
+// batch at a time so that Next is a load and an increment.
+class RandomGenerator {
+   public:
+    static constexpr int32_t kMax = RAND_MAX;
+
+    // Seeded from std::random_device.
+    RandomGenerator();
+    explicit RandomGenerator(uint64_t seed) { Seed(seed); }
+
+    // Restarts the sequence; the same seed gives the same values.
+    void Seed(uint64_t seed);
+
+    // Uniform in [0, kMax].
+    int32_t Next() {
+        if (next_ == kBatch) Refill();
+        return batch_[next_++];
+    }
+
+   private:
+    static constexpr size_t kBatch = 64;
+
+    uint64_t NextRaw();
+    void Refill();
+
+    uint64_t state_[4];
+    int32_t batch_[kBatch];
+    size_t next_ = kBatch;
+};
@@ -0,0 +1,140 @@
+#include "sampling_profiler.h"
+
+#include <sys/time.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+volatile std::sig_atomic_t SamplingProfiler::timer_expired_ = 0;
+
+namespace {
+
+struct sigaction previous_action;
+
+// Prints the entries of counts hottest first, self then inclusive.
+template <typename Counts>
+void PrintCounts(std::ostream& os, const char* title, uint64_t total,
+                 const std::map<std::string, Counts>& counts) {
+    std::vector<std::pair<std::string, Counts>> sorted(counts.begin(),
+                                                       counts.end());
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [](const auto& lhs, const auto& rhs) {
+                         if (lhs.second.self != rhs.second.self) {
+                             return lhs.second.self > rhs.second.self;
+                         }
+                         return lhs.second.inclusive > rhs.second.inclusive;
+                     });
+
+    char line[128];
+    std::snprintf(line, sizeof(line), "%-26s %15s %15s\n", title, "self",
+                  "inclusive");
+    os << line;
+    for (const auto& [name, count] : sorted) {
+        std::snprintf(line, sizeof(line),
+                      "  %-24s %8llu %5.1f%% %8llu %5.1f%%\n", name.c_str(),
+                      static_cast<unsigned long long>(count.self),
+                      100.0 * count.self / total,
+                      static_cast<unsigned long long>(count.inclusive),
+                      100.0 * count.inclusive / total);
+        os << line;
+    }
+}
+
+}  // namespace
+
+SamplingProfiler::SamplingProfiler(Mode mode, int period)
+    : mode_(mode), period_(period) {
+    if (period_ <= 0) {
+        period_ = mode == Mode::Count ? kDefaultCountPeriod
+                                      : kDefaultTimerPeriod;
+    }
+    period_ = std::min(period_, kMaxPeriod);
+    countdown_ = NextCountdown();
+    if (mode_ != Mode::Timer) return;
+
+    timer_expired_ = 0;
+    struct sigaction action = {};
+    action.sa_handler = OnTimer;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(SIGPROF, &action, &previous_action) != 0) {
+        throw std::runtime_error("Cannot install the profiler signal");
+    }
+
+    struct itimerval timer = {};
+    timer.it_interval.tv_sec = period_ / 1000000;
+    timer.it_interval.tv_usec = period_ % 1000000;
+    timer.it_value = timer.it_interval;
+    setitimer(ITIMER_PROF, &timer, nullptr);
+}
+
+SamplingProfiler::~SamplingProfiler() {
+    if (mode_ != Mode::Timer) return;
+    struct itimerval timer = {};
+    setitimer(ITIMER_PROF, &timer, nullptr);
+    sigaction(SIGPROF, &previous_action, nullptr);
+}
+
+void SamplingProfiler::OnTimer(int) { timer_expired_ = 1; }
+
+int SamplingProfiler::NextCountdown() {
+    // xorshift32
+    jitter_state_ ^= jitter_state_ << 13;
+    jitter_state_ ^= jitter_state_ >> 17;
+    jitter_state_ ^= jitter_state_ << 5;
+    return std::max(1, period_ / 2 + static_cast<int>(jitter_state_ %
+                                                      (period_ + 1)));
+}
+
+void SamplingProfiler::Sample() {
+    ++sample_count_;
+    // Globals are initialized before main is entered.
+    if (frames_.empty()) {
+        ++stacks_["<global>"];
+        return;
+    }
+
+    // Recursive calls count once towards the inclusive samples.
+    std::set<std::string> seen_functions;
+    std::set<std::string> seen_lines;
+    std::string stack;
+    std::string function;
+    std::string line;
+    for (const auto& frame : frames_) {
+        function = frame.function->name.Str();
+        line = function + ":" + std::to_string(frame.line);
+        if (!stack.empty()) stack += ';';
+        stack += line;
+        if (seen_functions.insert(function).second) {
+            ++functions_[function].inclusive;
+        }
+        if (seen_lines.insert(line).second) ++lines_[line].inclusive;
+    }
+    ++functions_[function].self;
+    ++lines_[line].self;
+    ++stacks_[stack];
+}
+
+void SamplingProfiler::WriteCollapsed(std::ostream& os) const {
+    for (const auto& [stack, count] : stacks_) {
+        os << stack << ' ' << count << '\n';
+    }
+}
+
+void SamplingProfiler::WriteReport(std::ostream& os) const {
+    os << sample_count_ << " samples, every " << period_
+       << (mode_ == Mode::Count ? " node visits\n" : " us of CPU time\n");
+    if (sample_count_ == 0) return;
+    PrintCounts(os, "function", sample_count_, functions_);
+    PrintCounts(os, "line", sample_count_, lines_);
+}
+
+std::optional<SamplingProfiler::Mode> ParseProfilerMode(
+    std::string_view name) {
+    if (name == "count") return SamplingProfiler::Mode::Count;
+    if (name == "timer") return SamplingProfiler::Mode::Timer;
+    return std::nullopt;
+}
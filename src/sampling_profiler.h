@@ -0,0 +1,99 @@
+#pragma once
+
+#include <csignal>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ast/ast.h"
+#include "ast/function.h"
+
+// Statistical profiler for the tree walker. The interpreter reports every
+// node it visits and every function it enters; at each sample the
+// profiler records the call path with the line executing in each frame.
+//
+// Samples are taken either every period node visits on average, or at the
+// first visit after a SIGPROF timer expired, every period microseconds of
+// CPU time. Visit counts are jittered by a fixed pseudo-random sequence,
+// so that a program looping with the period is not always sampled at the
+// same node, yet the profile of a program is reproducible.
+//
+// Functions run as native code by the JIT visit no nodes and so are not
+// sampled. Inlined calls count as lines of their caller, so profile with
+// --inline-budget=0 to see every function.
+class SamplingProfiler {
+   public:
+    enum class Mode { Count, Timer };
+
+    static constexpr int kDefaultCountPeriod = 1000;
+    static constexpr int kDefaultTimerPeriod = 1000;
+    // Longest period; a jittered countdown must still fit in an int.
+    static constexpr int kMaxPeriod = 1000000000;
+
+    // Only one timer profiler may run at a time: the signal and its timer
+    // belong to the process.
+    explicit SamplingProfiler(Mode mode, int period = 0);
+    ~SamplingProfiler();
+
+    SamplingProfiler(const SamplingProfiler&) = delete;
+    SamplingProfiler& operator=(const SamplingProfiler&) = delete;
+
+    void Visit(const AST::ASTNode* node) {
+        if (!frames_.empty()) frames_.back().line = node->loc.line;
+        if (mode_ == Mode::Count ? --countdown_ > 0 : !timer_expired_) {
+            return;
+        }
+        countdown_ = NextCountdown();
+        timer_expired_ = 0;
+        Sample();
+    }
+
+    void Enter(const AST::Function* function) {
+        frames_.push_back({function, function->loc.line});
+    }
+    void Leave() { frames_.pop_back(); }
+
+    uint64_t SampleCount() const { return sample_count_; }
+
+    // One line per distinct call path, frames as function:line from the
+    // outermost, followed by its sample count; the input of
+    // flamegraph.pl.
+    void WriteCollapsed(std::ostream& os) const;
+    // Self and inclusive samples per function and per line, hottest first.
+    void WriteReport(std::ostream& os) const;
+
+   private:
+    struct Frame {
+        const AST::Function* function;
+        int line;
+    };
+    struct Counts {
+        uint64_t self = 0;
+        uint64_t inclusive = 0;
+    };
+
+    void Sample();
+    // Visits until the next sample, uniform in [period / 2, period * 3 / 2].
+    int NextCountdown();
+
+    static void OnTimer(int);
+    static volatile std::sig_atomic_t timer_expired_;
+
+    Mode mode_;
+    int period_;
+    int countdown_;
+    uint32_t jitter_state_ = 0x9e3779b9;
+
+    std::vector<Frame> frames_;
+    uint64_t sample_count_ = 0;
+    std::map<std::string, uint64_t> stacks_;
+    std::map<std::string, Counts> functions_;
+    std::map<std::string, Counts> lines_;
+};
+
+std::optional<SamplingProfiler::Mode> ParseProfilerMode(
+    std::string_view name);
@@ -52,9 +52,13 @@
 #define YY_DECL \
     EzAquarii::Parser::symbol_type EzAquarii::Scanner::get_next_token()
 
+#include <algorithm>
+#include <cstring>
 #include <string>
+#include <string_view>
 
 #include "parser.hpp"  // this is needed for symbol_type
+#include "stats.h"
 
 namespace EzAquarii {
 
@@ -68,13 +72,52 @@ class Scanner : public yyFlexLexer {
     virtual ~Scanner() {}
     virtual EzAquarii::Parser::symbol_type get_next_token();
 
+    // get_next_token, with the time spent and the allocations made added
+    // to the stats set by SetStats.
+    EzAquarii::Parser::symbol_type NextToken() {
+        ++token_count_;
+        if (!stats_) return get_next_token();
+        PhaseTimer timer(stats_);
+        auto token = get_next_token();
+        timer.Stop();
+        return token;
+    }
+
+    void SetStats(PhaseStats* stats) { stats_ = stats; }
+    // Tokens returned since the input was set, end of file included.
+    size_t TokenCount() const { return token_count_; }
+
+    // Scans input, which must outlive the scan, instead of yyin.
+    void SetInput(std::string_view input) {
+        input_ = input;
+        position_ = 0;
+        token_count_ = 0;
+        yyrestart(nullptr);
+    }
+
+   protected:
+    // Feeds flex's buffer straight from the input without a stream.
+    int LexerInput(char* buf, int max_size) override {
+        size_t size = std::min(input_.size() - position_,
+                               static_cast<size_t>(max_size));
+        std::memcpy(buf, input_.data() + position_, size);
+        position_ += size;
+        return size;
+    }
+
    private:
     ParserDriver& driver_;
+    std::string_view input_;
+    size_t position_ = 0;
+
+    PhaseStats* stats_ = nullptr;
+    size_t token_count_ = 0;
 };
 
 }  // namespace EzAquarii
 
-inline std::string unescape(const std::string& input) {
+// Value of a string literal token, quotes included.
+inline std::string unescape(std::string_view input) {
     std::string result;
     for (size_t i = 1; i < input.length() - 1;
          ++i) {  // skip surrounding quotes
@@ -1,6 +1,7 @@
 #include "semantic_visitor.h"
 
 #include <algorithm>
+#include <thread>
 
 #include "ast/arithmetic_op.h"
 #include "ast/array.h"
@@ -19,6 +20,7 @@
 #include "ast/type.h"
 #include "ast/var.h"
 #include "ast/while.h"
+#include "thread_pool.h"
 
 void SemanticVisitor::visit(AST::ArithOp* node) {
     node->lhs->accept(this);
@@ -34,11 +36,12 @@ void SemanticVisitor::visit(AST::ArithOp* node) {
 }
 
 void SemanticVisitor::visit(AST::ArrayAccess* node) {
-    auto* entry = symtable.Find(node->name);
+    auto* entry = FindSymbol(node->name);
     if (!entry) {
         Error(node, "Undeclared array variable ", node->name);
     }
     node->type = entry->type.GetArrayBase();
+    node->ref = entry->ref;
 
     node->index->accept(this);
 
@@ -51,10 +54,11 @@ void SemanticVisitor::visit(AST::ArrayAccess* node) {
 }
 
 void SemanticVisitor::visit(AST::ArrayAssignment* node) {
-    auto* entry = symtable.Find(node->name);
+    auto* entry = FindSymbol(node->name);
     if (!entry) {
         Error(node, "Undeclared array variable ", node->name);
     }
+    node->ref = entry->ref;
     node->index->accept(this);
 
     if (auto index = std::dynamic_pointer_cast<AST::Integer>(node->index);
@@ -73,28 +77,76 @@ void SemanticVisitor::visit(AST::ArrayAssignment* node) {
     }
 }
 
-void SemanticVisitor::VarDef(AST::ASTNode* node, const std::string& name,
-                             AST::Type type) {
-    if (auto iter = functions.find(name); iter != functions.end()) {
+AST::VarRef SemanticVisitor::VarDef(AST::ASTNode* node, AST::Symbol name,
+                                    AST::Type type) {
+    if (FindFunction(name)) {
         Error(node, "'", type, " ", name,
               "' redeclared as different kind of entity");
     }
-    if (auto* entry = symtable.Declare(name, {type, node->loc}); entry) {
+    auto ref = NewSlot();
+    if (auto* entry = symtable.Declare(name, {type, node->loc, ref, order_});
+        entry) {
         Error(node, "Redeclaration of ", name, ". Previously declared at ",
               entry->loc);
     }
-    ir_->AddSymbol(name, {type});
+    if (symbols_) {
+        symbols_->emplace_back(name, SymbolInfo{type});
+    } else {
+        ir_->AddSymbol(name, {type});
+    }
+    return ref;
+}
+
+SymbolEntry* SemanticVisitor::FindSymbol(AST::Symbol name) {
+    if (auto* entry = symtable.Find(name); entry || program_ == this) {
+        return entry;
+    }
+    // Globals are only read while bodies are checked, so the checkers
+    // share them.
+    auto* entry = program_->symtable.Find(name);
+    return entry && entry->order < order_ ? entry : nullptr;
+}
+
+AST::Function* SemanticVisitor::FindFunction(AST::Symbol name) const {
+    const auto& declared = program_->functions;
+    auto iter = declared.find(name);
+    if (iter == declared.end() || iter->second.order > order_) {
+        return nullptr;
+    }
+    return iter->second.function;
+}
+
+AST::VarRef SemanticVisitor::NewSlot() {
+    if (!current_function_) {
+        ir_->SetGlobalCount(global_count_ + 1);
+        return {AST::VarRef::Scope::Global, global_count_++};
+    }
+    current_function_->frame_size =
+        std::max(current_function_->frame_size, next_slot_ + 1);
+    return {AST::VarRef::Scope::Local, next_slot_++};
+}
+
+void SemanticVisitor::PushScope() {
+    symtable.PushScope();
+    scope_slots_.push_back(next_slot_);
+}
+
+void SemanticVisitor::PopScope() {
+    symtable.PopScope();
+    next_slot_ = scope_slots_.back();
+    scope_slots_.pop_back();
 }
 
 void SemanticVisitor::visit(AST::ArrayDeclaration* node) {
-    VarDef(node, node->name, node->type);
+    node->ref = VarDef(node, node->name, node->type);
 }
 
 void SemanticVisitor::visit(AST::Assign* node) {
-    auto* entry = symtable.Find(node->var);
+    auto* entry = FindSymbol(node->var);
     if (!entry) {
         Error(node, "Undeclared variable ", node->var);
     }
+    node->ref = entry->ref;
     node->expr->accept(this);
     if (entry->type != node->expr->type) {
         Error(node, "Type mismatch: cannot assign ", node->expr->type, " to ",
@@ -105,52 +157,65 @@ void SemanticVisitor::visit(AST::Assign* node) {
 void SemanticVisitor::visit(AST::BoolLiteral* node) {}
 
 void SemanticVisitor::visit(AST::FunCall* node) {
-    if (symtable.Find(node->name)) {
+    if (FindSymbol(node->name)) {
         Error(node, "'", node->name, "' cannot be used as a function");
     }
-    auto iter = functions.find(node->name);
-    if (iter == functions.end()) {
+    auto* function = FindFunction(node->name);
+    if (!function) {
         Error(node, "'", node->name, "' was not declared in this scope");
     }
-    node->type = iter->second->return_type;
+    node->target = function;
+    node->type = function->return_type;
 
-    if (node->args.size() != iter->second->args.size()) {
+    if (node->args.size() != function->args.size()) {
         Error(node, "Incorrect arguments number to call ", node->name,
-              ". Expected ", iter->second->args.size(), " but got ",
+              ". Expected ", function->args.size(), " but got ",
               node->args.size());
     }
 
     for (size_t i = 0; i < node->args.size(); ++i) {
         node->args[i]->accept(this);
-        if (node->args[i]->type != iter->second->args[i].type) {
+        if (node->args[i]->type != function->args[i].type) {
             Error(node, "Incorrect argument ", i, " type to call ", node->name,
-                  ". Expected ", iter->second->args[i].type, " but got ",
+                  ". Expected ", function->args[i].type, " but got ",
                   node->args[i]->type);
         }
     }
 }
 
 void SemanticVisitor::visit(AST::Function* node) {
-    if (auto entry = symtable.Find(node->name); entry) {
+    // Functions of the program are declared and checked by
+    // visit(AST::Program*); any other one is nested in a body.
+    Error(current_function_ ? current_function_ : node,
+          "a function-definition is not allowed here");
+}
+
+void SemanticVisitor::DeclareFunction(AST::Function* node) {
+    if (auto entry = FindSymbol(node->name); entry) {
         Error(node, "'", node->return_type, " ", node->name,
               "' redeclared as different kind of entity");
     }
 
-    if (auto iter = functions.find(node->name); iter != functions.end()) {
+    if (auto* previous = FindFunction(node->name); previous) {
         Error(node, "redefinition of '", node->return_type, " ", node->name,
               "()'"
               ". Previously defined here ",
-              iter->second->loc);
+              previous->loc);
     }
-    functions[node->name] = node;
+    functions[node->name] = {node, order_};
     ir_->AddFunction(node->name, std::dynamic_pointer_cast<AST::Function>(
                                      node->shared_from_this()));
+}
 
-    symtable.PushScope();
+void SemanticVisitor::CheckBody(AST::Function* node) {
+    current_function_ = node;
+    next_slot_ = 0;
+    node->frame_size = 0;
+    PushScope();
 
     for (size_t i = 0; i < node->args.size(); ++i) {
-        if (auto* entry = symtable.Declare(node->args[i].name,
-                                           {node->args[i].type, node->loc});
+        if (auto* entry = symtable.Declare(
+                node->args[i].name, {node->args[i].type, node->loc, NewSlot()});
             entry) {
             Error(node, "redefinition of '", node->args[i].type, " ",
                   node->args[i].name, "'. Previously defined here ",
@@ -162,9 +227,6 @@ void SemanticVisitor::visit(AST::Function* node) {
     for (auto stmt : node->body) {
         stmt->accept(this);
 
-        if (std::dynamic_pointer_cast<AST::Function>(stmt)) {
-            Error(node, "a function-definition is not allowed here");
-        }
         if (auto return_node = std::dynamic_pointer_cast<AST::Return>(stmt);
             return_node) {
             has_return = true;
@@ -181,7 +243,8 @@ void SemanticVisitor::visit(AST::Function* node) {
               " no return statement in function returning non-void");
     }
 
-    symtable.PopScope();
+    PopScope();
+    current_function_ = nullptr;
 }
 
 void SemanticVisitor::visit(AST::IfThenElse* node) {
@@ -192,22 +255,22 @@ void SemanticVisitor::visit(AST::IfThenElse* node) {
         Error(node, "Type mismatch: condition is not bool");
     }
 
-    symtable.PushScope();
+    PushScope();
 
     for (size_t i = 0; i < node->then_branch.size(); ++i) {
         node->then_branch[i]->accept(this);
     }
 
-    symtable.PopScope();
+    PopScope();
 
     if (!node->else_branch.empty()) {
-        symtable.PushScope();
+        PushScope();
 
         for (size_t i = 0; i < node->else_branch.size(); ++i) {
             node->else_branch[i]->accept(this);
         }
 
-        symtable.PopScope();
+        PopScope();
     }
 }
 
@@ -227,19 +290,85 @@ void SemanticVisitor::visit(AST::LogicOp* node) {
 void SemanticVisitor::visit(AST::Print* node) { node->expr->accept(this); }
 
 void SemanticVisitor::visit(AST::Program* node) {
+    const auto& globals = node->globals;
+    std::vector<SymbolList> symbols(globals.size());
+    std::vector<std::exception_ptr> errors(globals.size());
+
+    // Variables and signatures in order. A failing global ends the pass,
+    // but the bodies before it may fail earlier and are still checked.
+    std::vector<AST::Function*> bodies;
+    std::vector<size_t> orders;
+    const AST::Symbol main_name("main");
     bool has_main = false;
-    for (auto function : node->globals) {
-        if (auto func = std::dynamic_pointer_cast<AST::Function>(function);
-            func && func->name == "main") {
-            has_main = true;
+    for (order_ = 0; order_ < globals.size(); ++order_) {
+        symbols_ = &symbols[order_];
+        try {
+            auto* global = globals[order_].get();
+            auto* function = dynamic_cast<AST::Function*>(global);
+            if (!function) {
+                global->accept(this);
+                continue;
+            }
+            has_main |= function->name == main_name;
+            DeclareFunction(function);
+            bodies.push_back(function);
+            orders.push_back(order_);
+        } catch (...) {
+            errors[order_] = std::current_exception();
+            break;
+        }
+    }
+    symbols_ = nullptr;
+
+    size_t threads = jobs_ ? jobs_ : std::thread::hardware_concurrency();
+    if (threads <= 1 || bodies.size() < kMinParallelFunctions) {
+        SemanticVisitor(this).CheckBodies(bodies, orders, 0,
+                                          bodies.size(), &symbols, &errors);
+    } else {
+        ThreadPool pool(threads);
+        // Several chunks per thread, so that stealing evens out bodies of
+        // different sizes.
+        size_t chunk = std::max<size_t>(1, bodies.size() / (threads * 8));
+        for (size_t begin = 0; begin < bodies.size(); begin += chunk) {
+            size_t end = std::min(bodies.size(), begin + chunk);
+            pool.Submit([&, begin, end] {
+                SemanticVisitor(this).CheckBodies(bodies, orders, begin,
+                                                  end, &symbols, &errors);
+            });
         }
-        function->accept(this);
+        pool.Wait();
+    }
+
+    for (const auto& error : errors) {
+        if (error) std::rethrow_exception(error);
+    }
+    // In source order, so a name declared in several places keeps the
+    // type of its last declaration.
+    for (const auto& list : symbols) {
+        for (const auto& [name, info] : list) ir_->AddSymbol(name, info);
     }
     if (!has_main) {
         Error(node, "Main function isn't found");
     }
 }
 
+void SemanticVisitor::CheckBodies(
+    const std::vector<AST::Function*>& bodies,
+    const std::vector<size_t>& orders, size_t begin, size_t end,
+    std::vector<SymbolList>* symbols,
+    std::vector<std::exception_ptr>* errors) {
+    for (size_t i = begin; i < end; ++i) {
+        order_ = orders[i];
+        symbols_ = &(*symbols)[order_];
+        try {
+            CheckBody(bodies[i]);
+        } catch (...) {
+            (*errors)[order_] = std::current_exception();
+            return;
+        }
+    }
+}
+
 void SemanticVisitor::visit(AST::Rand* node) {}
 
 void SemanticVisitor::visit(AST::Return* node) {
@@ -252,25 +381,26 @@ void SemanticVisitor::visit(AST::Return* node) {
 void SemanticVisitor::visit(AST::StringLiteral* node) {}
 
 void SemanticVisitor::visit(AST::Var* node) {
-    auto* entry = symtable.Find(node->name);
+    auto* entry = FindSymbol(node->name);
     if (!entry) {
         Error(node, "Undeclared variable ", node->name);
     }
     node->type = entry->type;
+    node->ref = entry->ref;
 }
 
 void SemanticVisitor::visit(AST::VarDef* node) {
-    VarDef(node, node->name, node->type);
+    node->ref = VarDef(node, node->name, node->type);
 }
 
 void SemanticVisitor::visit(AST::While* node) {
     node->condition->accept(this);
 
-    symtable.PushScope();
+    PushScope();
 
     for (size_t i = 0; i < node->body.size(); ++i) {
         node->body[i]->accept(this);
     }
 
-    symtable.PopScope();
+    PopScope();
 }
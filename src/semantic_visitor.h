@@ -2,14 +2,18 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <exception>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "ast/ast.h"
 #include "ast/type.h"
+#include "ast/var_ref.h"
 #include "call_stack.h"
 #include "i_visitor.h"
 #include "ir.h"
@@ -17,11 +21,25 @@
 struct SymbolEntry {
     AST::Type type;
     AST::Location loc;
+    AST::VarRef ref;
+    // Index in the program of the global declaring it, or of the function
+    // whose body does.
+    size_t order = 0;
 };
 
+// Checks a program in two phases. A serial pass over the globals declares
+// the variables and function signatures; then every function body is
+// checked on its own, on up to jobs threads, seeing only what is declared
+// before it. When several bodies fail, the error reported is the one of
+// the earliest global, as with a single pass in source order.
 class SemanticVisitor : public IASTVisitor {
    public:
-    SemanticVisitor(IR* ir) : ir_(ir) {}
+    // Programs with fewer functions are checked on the calling thread.
+    static constexpr size_t kMinParallelFunctions = 64;
+
+    // Zero jobs means one per hardware thread.
+    explicit SemanticVisitor(IR* ir, size_t jobs = 1)
+        : ir_(ir), jobs_(jobs), program_(this) {}
 
     void visit(AST::ArithOp* node) override;
     void visit(AST::ArrayAccess* node) override;
@@ -44,7 +62,37 @@ class SemanticVisitor : public IASTVisitor {
     void visit(AST::While* node) override;
 
    private:
-    void VarDef(AST::ASTNode* node, const std::string& name, AST::Type type);
+    struct FunctionEntry {
+        AST::Function* function;
+        size_t order;
+    };
+    using SymbolList = std::vector<std::pair<AST::Symbol, SymbolInfo>>;
+
+    // Checker of the bodies of functions declared by program, recording
+    // the symbols it declares in a list instead of the IR.
+    explicit SemanticVisitor(SemanticVisitor* program)
+        : ir_(program->ir_), program_(program) {}
+
+    // Checks bodies[begin, end), the function of globals[i] recording its
+    // symbols in symbols[i] and its error in errors[i]. Stops at the first
+    // error.
+    void CheckBodies(const std::vector<AST::Function*>& bodies,
+                     const std::vector<size_t>& orders, size_t begin,
+                     size_t end, std::vector<SymbolList>* symbols,
+                     std::vector<std::exception_ptr>* errors);
+
+    void DeclareFunction(AST::Function* node);
+    void CheckBody(AST::Function* node);
+
+    // Lookups of the names visible from the global being checked.
+    SymbolEntry* FindSymbol(AST::Symbol name);
+    AST::Function* FindFunction(AST::Symbol name) const;
+
+    AST::VarRef VarDef(AST::ASTNode* node, AST::Symbol name, AST::Type type);
+
+    AST::VarRef NewSlot();
+    void PushScope();
+    void PopScope();
 
     template <typename... Args>
     void Error(AST::ASTNode* node, Args... args) {
@@ -56,7 +104,22 @@ class SemanticVisitor : public IASTVisitor {
     }
 
     IR* ir_;
+    size_t jobs_ = 1;
+
+    // The visitor holding the globals; this one unless checking bodies.
+    SemanticVisitor* program_;
+    // Index of the global being checked.
+    size_t order_ = 0;
+    // Where symbols go instead of the IR while checking a body.
+    SymbolList* symbols_ = nullptr;
 
     CallStack<SymbolEntry> symtable;
-    std::unordered_map<std::string, AST::Function*> functions;
+    std::unordered_map<AST::Symbol, FunctionEntry> functions;
+
+    // Slot allocation for the function being checked. Slots of a block are
+    // released when the block ends and reused by the following blocks.
+    AST::Function* current_function_ = nullptr;
+    int next_slot_ = 0;
+    std::vector<int> scope_slots_;
+    int global_count_ = 0;
 };
\ No newline at end of file
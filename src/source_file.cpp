@@ -0,0 +1,72 @@
+#include "source_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+SourceFile::SourceFile(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open " + path + ": " +
+                                 std::strerror(errno));
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        int error = errno;
+        close(fd);
+        throw std::runtime_error("Cannot open " + path + ": " +
+                                 std::strerror(error));
+    }
+
+    // Pipes and terminals report no size and cannot be mapped, so they are
+    // read into a buffer instead.
+    if (!S_ISREG(st.st_mode)) {
+        ReadAll(fd, path);
+        close(fd);
+        return;
+    }
+
+    // An empty file cannot be mapped and has nothing to scan.
+    size_ = st.st_size;
+    if (size_ > 0) {
+        void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            int error = errno;
+            close(fd);
+            throw std::runtime_error("Cannot map " + path + ": " +
+                                     std::strerror(error));
+        }
+        madvise(data, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const char*>(data);
+        mapped_ = true;
+    }
+    close(fd);
+}
+
+SourceFile::~SourceFile() {
+    if (mapped_) munmap(const_cast<char*>(data_), size_);
+}
+
+void SourceFile::ReadAll(int fd, const std::string& path) {
+    char chunk[1 << 16];
+    for (;;) {
+        ssize_t n = read(fd, chunk, sizeof(chunk));
+        if (n == 0) break;
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            int error = errno;
+            close(fd);
+            throw std::runtime_error("Cannot read " + path + ": " +
+                                     std::strerror(error));
+        }
+        buffer_.append(chunk, n);
+    }
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+}
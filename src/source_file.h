@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+// Read-only memory mapping of a source file. The scanner reads the program
+// straight out of the mapping and identifier tokens are views into it, so
+// the file is never copied into a stream or a string. Files that cannot be
+// mapped, such as pipes, are read into a buffer owned by the object.
+class SourceFile {
+   public:
+    // Throws std::runtime_error if the file cannot be opened, mapped or
+    // read.
+    explicit SourceFile(const std::string& path);
+    ~SourceFile();
+
+    SourceFile(const SourceFile&) = delete;
+    SourceFile& operator=(const SourceFile&) = delete;
+
+    std::string_view Text() const { return {data_, size_}; }
+
+   private:
+    void ReadAll(int fd, const std::string& path);
+
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    bool mapped_ = false;
+    std::string buffer_;
+};
@@ -0,0 +1,48 @@
+#include "stats.h"
+
+#include <sys/resource.h>
+
+#include <cstdio>
+
+namespace {
+
+// Per thread, so counting needs no atomics and a phase only sees its own
+// thread's allocations.
+thread_local AllocationCount allocations;
+
+void PrintPhase(std::ostream& os, const char* name, const PhaseStats& phase) {
+    char line[96];
+    std::snprintf(line, sizeof(line), "%-10s %10.3f %10llu %12llu %10ld\n",
+                  name, phase.wall.count() / 1e6,
+                  static_cast<unsigned long long>(phase.allocations),
+                  static_cast<unsigned long long>(phase.allocated_bytes),
+                  phase.peak_rss_kb);
+    os << line;
+}
+
+}  // namespace
+
+AllocationCount ThreadAllocations() { return allocations; }
+
+void CountAllocation(std::size_t size) {
+    ++allocations.count;
+    allocations.bytes += size;
+}
+
+long PeakRssKb() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+std::ostream& operator<<(std::ostream& os, const Stats& stats) {
+    os << "phase         wall ms     allocs  alloc bytes   peak KiB\n";
+    PrintPhase(os, "scan", stats.scan);
+    PrintPhase(os, "parse", stats.parse);
+    PrintPhase(os, "semantic", stats.semantic);
+    PrintPhase(os, "optimize", stats.optimize);
+    PrintPhase(os, "execute", stats.execute);
+    return os << "tokens " << stats.tokens << ", AST nodes "
+              << stats.ast_nodes << ", symbols " << stats.symbols
+              << ", functions " << stats.functions << '\n';
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+// Allocations made through the global operator new on the calling thread
+// since it started. Only programs linking allocation_counter.cpp, which
+// replaces operator new, count them; elsewhere the counts stay zero.
+struct AllocationCount {
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+};
+
+AllocationCount ThreadAllocations();
+
+// Adds one allocation of size bytes to the calling thread's count.
+void CountAllocation(std::size_t size);
+
+// Peak resident set size of the process so far, in KiB.
+long PeakRssKb();
+
+// Cost of one phase of compiling or running a program.
+struct PhaseStats {
+    std::chrono::nanoseconds wall{0};
+    uint64_t allocations = 0;
+    uint64_t allocated_bytes = 0;
+    // Peak resident set size of the process at the end of the phase.
+    long peak_rss_kb = 0;
+
+    // Takes out the cost of a phase nested in this one.
+    void Exclude(const PhaseStats& inner) {
+        wall -= inner.wall;
+        allocations -= inner.allocations;
+        allocated_bytes -= inner.allocated_bytes;
+    }
+};
+
+// Adds the wall time and allocations between construction and Stop to a
+// phase. Cheap enough to run around every token.
+class PhaseTimer {
+   public:
+    explicit PhaseTimer(PhaseStats* stats)
+        : stats_(stats),
+          start_(std::chrono::steady_clock::now()),
+          allocations_(ThreadAllocations()) {}
+
+    void Stop() {
+        auto allocations = ThreadAllocations();
+        stats_->wall += std::chrono::steady_clock::now() - start_;
+        stats_->allocations += allocations.count - allocations_.count;
+        stats_->allocated_bytes += allocations.bytes - allocations_.bytes;
+    }
+
+   private:
+    PhaseStats* stats_;
+    std::chrono::steady_clock::time_point start_;
+    AllocationCount allocations_;
+};
+
+// What Driver measured while compiling and running a program.
+struct Stats {
+    PhaseStats scan;
+    PhaseStats parse;
+    PhaseStats semantic;
+    PhaseStats optimize;
+    PhaseStats execute;
+
+    size_t tokens = 0;
+    size_t ast_nodes = 0;
+    // Distinct variable and function names in the program.
+    size_t symbols = 0;
+    size_t functions = 0;
+};
+
+std::ostream& operator<<(std::ostream& os, const Stats& stats);
@@ -0,0 +1,90 @@
+#include "thread_pool.h"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(size_t threads) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (size_t i = 0; i < threads; ++i) {
+        queues_.push_back(std::make_unique<Queue>());
+    }
+    for (size_t i = 0; i < threads; ++i) {
+        threads_.emplace_back(&ThreadPool::Work, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    work_ready_.notify_all();
+    for (auto& thread : threads_) thread.join();
+}
+
+void ThreadPool::Submit(std::function<void()> task) {
+    // Counted before it is queued, so that a worker popping it right away
+    // never sees the count go below zero.
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++queued_;
+        ++unfinished_;
+    }
+    auto& queue = *queues_[next_queue_++ % queues_.size()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+    work_ready_.notify_one();
+}
+
+void ThreadPool::Wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    all_done_.wait(lock, [this] { return unfinished_ == 0; });
+}
+
+bool ThreadPool::TryPop(size_t worker, std::function<void()>* task) {
+    auto& queue = *queues_[worker];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) return false;
+    *task = std::move(queue.tasks.front());
+    queue.tasks.pop_front();
+    return true;
+}
+
+bool ThreadPool::TrySteal(size_t worker, std::function<void()>* task) {
+    for (size_t i = 1; i < queues_.size(); ++i) {
+        auto& queue = *queues_[(worker + i) % queues_.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) continue;
+        *task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        return true;
+    }
+    return false;
+}
+
+void ThreadPool::Work(size_t worker) {
+    std::function<void()> task;
+    while (true) {
+        if (TryPop(worker, &task) || TrySteal(worker, &task)) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                --queued_;
+            }
+            task();
+            task = nullptr;
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--unfinished_ == 0) all_done_.notify_all();
+            continue;
+        }
+
+        // A task counted but not pushed yet makes queued_ nonzero, and the
+        // worker retries until it shows up in a deque.
+        std::unique_lock<std::mutex> lock(mutex_);
+        work_ready_.wait(lock, [this] { return queued_ > 0 || stopping_; });
+        if (queued_ == 0 && stopping_) return;
+    }
+}
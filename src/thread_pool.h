@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads with one task deque each. Tasks are dealt to
+// the deques round robin; a worker runs its own tasks in order and, once
+// its deque is empty, steals from the back of another one, so a worker
+// stuck on a long program does not hold up the ones queued behind it.
+class ThreadPool {
+   public:
+    // Zero threads means one per hardware thread.
+    explicit ThreadPool(size_t threads = 0);
+    // Finishes the queued tasks and joins the workers.
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Tasks must not throw.
+    void Submit(std::function<void()> task);
+    // Blocks until every submitted task has finished.
+    void Wait();
+
+    size_t Size() const { return threads_.size(); }
+
+   private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    bool TryPop(size_t worker, std::function<void()>* task);
+    bool TrySteal(size_t worker, std::function<void()>* task);
+    void Work(size_t worker);
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> threads_;
+    std::atomic<size_t> next_queue_{0};
+
+    // Guards the counts below; workers sleep on work_ready_ when no task
+    // is queued.
+    std::mutex mutex_;
+    std::condition_variable work_ready_;
+    std::condition_variable all_done_;
+    size_t queued_ = 0;
+    size_t unfinished_ = 0;
+    bool stopping_ = false;
+};
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "output_buffer.h"
+
+class Object {
+   public:
+    virtual ~Object() = default;
+    virtual void Print(OutputBuffer& out) = 0;
+};
+
+class ArrayObject;
+class StringObject;
+
+// Runtime value. Ints and bools are stored inline; only strings and arrays
+// live on the heap, so arithmetic never allocates or touches a refcount.
+class Value {
+   public:
+    enum class Tag : uint8_t { None, Int, Bool, String, Array };
+
+    Value() = default;
+
+    static Value None() { return {}; }
+    static Value Int(int value) { return Value(Tag::Int, value); }
+    static Value Bool(bool value) { return Value(Tag::Bool, value); }
+    static Value String(std::string value);
+    static Value NewArray(int size);
+
+    Tag GetTag() const { return tag_; }
+
+    bool IsInt() const { return tag_ == Tag::Int; }
+    bool IsBool() const { return tag_ == Tag::Bool; }
+    bool IsArray() const { return tag_ == Tag::Array; }
+
+    int AsInt() const { return payload_; }
+    bool AsBool() const { return payload_ != 0; }
+
+    // Raw inline payload, shared by ints and bools.
+    int32_t Payload() const { return payload_; }
+
+    ArrayObject* AsArray() const;
+
+    void Print(OutputBuffer& out) const;
+
+    explicit operator bool() const { return tag_ != Tag::None; }
+
+    // Byte offsets of the tag and the inline payload, for generated code
+    // that reads and writes ints and bools in place.
+    static size_t TagOffset();
+    static size_t PayloadOffset();
+    // Byte offset of the object pointer held in place, for generated code
+    // loading the array of a global that may have been reassigned.
+    static size_t ObjectOffset();
+
+   private:
+    Value(Tag tag, int32_t payload) : tag_(tag), payload_(payload) {}
+    Value(Tag tag, std::shared_ptr<Object> object)
+        : tag_(tag), object_(std::move(object)) {}
+
+    Tag tag_ = Tag::None;
+    int32_t payload_ = 0;
+    std::shared_ptr<Object> object_;
+};
+
+class StringObject : public Object {
+   public:
+    explicit StringObject(std::string value) : value_(std::move(value)) {}
+
+    void Print(OutputBuffer& out) override { out.Write(value_); }
+
+    const std::string& GetValue() const { return value_; }
+
+   private:
+    std::string value_;
+};
+
+// Int array allocated at its declared size and zero-filled, so elements
+// never written read as 0 and an index outside [0, size) fails on reads
+// and writes alike. Stored as one flat buffer, so element accesses touch
+// no refcount and bulk operations and generated code can work on the raw
+// data.
+class ArrayObject : public Object {
+   public:
+    explicit ArrayObject(int size)
+        : size_(size), data_(new int32_t[size]()) {}
+    ~ArrayObject() override { delete[] data_; }
+
+    ArrayObject(const ArrayObject&) = delete;
+    ArrayObject& operator=(const ArrayObject&) = delete;
+
+    void Print(OutputBuffer& out) override {
+        throw std::runtime_error("call ArrayObject Print");
+    }
+
+    int Size() const { return size_; }
+    int32_t* Data() { return data_; }
+    const int32_t* Data() const { return data_; }
+
+    int32_t Load(int i) const {
+        CheckIndex(i);
+        return data_[i];
+    }
+
+    void Store(int i, int32_t value) {
+        CheckIndex(i);
+        data_[i] = value;
+    }
+
+    // Unchecked access for indices proven to be in bounds.
+    int32_t LoadUnchecked(int i) const { return data_[i]; }
+    void StoreUnchecked(int i, int32_t value) { data_[i] = value; }
+
+    // Byte offset of the data pointer, for generated code indexing the
+    // buffer directly.
+    static size_t DataOffset() {
+        ArrayObject probe(0);
+        return reinterpret_cast<const char*>(&probe.data_) -
+               reinterpret_cast<const char*>(&probe);
+    }
+
+   private:
+    void CheckIndex(int i) const {
+        if (i < 0 || i >= size_) {
+            throw std::runtime_error("array access " + std::to_string(i) +
+                                     " out of bounds " +
+                                     std::to_string(size_));
+        }
+    }
+
+    int size_;
+    int32_t* data_;
+};
+
+inline Value Value::String(std::string value) {
+    return Value(Tag::String, std::make_shared<StringObject>(std::move(value)));
+}
+
+inline Value Value::NewArray(int size) {
+    return Value(Tag::Array, std::make_shared<ArrayObject>(size));
+}
+
+inline ArrayObject* Value::AsArray() const {
+    return static_cast<ArrayObject*>(object_.get());
+}
+
+inline size_t Value::TagOffset() {
+    Value probe;
+    return reinterpret_cast<const char*>(&probe.tag_) -
+           reinterpret_cast<const char*>(&probe);
+}
+
+inline size_t Value::PayloadOffset() {
+    Value probe;
+    return reinterpret_cast<const char*>(&probe.payload_) -
+           reinterpret_cast<const char*>(&probe);
+}
+
+inline size_t Value::ObjectOffset() {
+    // The shared_ptr stores the pointer to its object in one of its words;
+    // the other one points to the control block.
+    Value probe = NewArray(0);
+    Object* object = probe.object_.get();
+    const char* base = reinterpret_cast<const char*>(&probe);
+    const char* words = reinterpret_cast<const char*>(&probe.object_);
+    for (size_t offset = 0; offset < sizeof(probe.object_);
+         offset += sizeof(object)) {
+        if (std::memcmp(words + offset, &object, sizeof(object)) == 0) {
+            return words + offset - base;
+        }
+    }
+    throw std::logic_error("Object pointer not stored in place");
+}
+
+inline void Value::Print(OutputBuffer& out) const {
+    switch (tag_) {
+        case Tag::None:
+            break;
+        case Tag::Int:
+            out.WriteInt(payload_);
+            break;
+        case Tag::Bool:
+            out.WriteBool(AsBool());
+            break;
+        case Tag::String:
+        case Tag::Array:
+            object_->Print(out);
+            break;
+    }
+}
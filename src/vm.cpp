@@ -0,0 +1,164 @@
+#include "vm.h"
+
+#include <cstdlib>
+
+#include "ast/var.h"
+#include "bytecode_compiler.h"
+
+using Bytecode::OpCode;
+
+int VM::Exec() {
+    module_ = BytecodeCompiler(ir_).Compile();
+    globals_.assign(module_.globals_count, Value::None());
+
+    Run(module_.init_function);
+    auto value = Run(module_.main_function);
+
+    if (value.IsInt()) return value.AsInt();
+
+    return 1;
+}
+
+Value VM::Run(int function_index) {
+    const Bytecode::Function* function = &module_.functions[function_index];
+    size_t base = stack_.Size();
+    size_t pushed = ReserveFrame(base, function->frame_size);
+
+    Value* regs = stack_.Data() + base;
+    const Bytecode::Instruction* code = function->code.data();
+    size_t pc = 0;
+
+    for (;;) {
+        const Bytecode::Instruction& ins = code[pc++];
+        switch (ins.op) {
+            case OpCode::LoadConst:
+                regs[ins.a] = module_.constants[ins.b];
+                break;
+            case OpCode::LoadGlobal:
+                regs[ins.a] = globals_[ins.b];
+                break;
+            case OpCode::StoreGlobal:
+                globals_[ins.a] = regs[ins.b];
+                break;
+            case OpCode::Move:
+                regs[ins.a] = regs[ins.b];
+                break;
+            case OpCode::Clear:
+                regs[ins.a] = Value::None();
+                break;
+            case OpCode::CheckInit:
+                if (!regs[ins.a]) {
+                    auto* var = static_cast<const AST::Var*>(
+                        function->origins[pc - 1]);
+                    Error(var, "Variable ", var->name, " uninitialized");
+                }
+                break;
+            case OpCode::NewArray:
+                regs[ins.a] = Value::NewArray(ins.b);
+                break;
+            case OpCode::Add:
+                regs[ins.a] =
+                    Value::Int(regs[ins.b].AsInt() + regs[ins.c].AsInt());
+                break;
+            case OpCode::Sub:
+                regs[ins.a] =
+                    Value::Int(regs[ins.b].AsInt() - regs[ins.c].AsInt());
+                break;
+            case OpCode::Mul:
+                regs[ins.a] =
+                    Value::Int(regs[ins.b].AsInt() * regs[ins.c].AsInt());
+                break;
+            case OpCode::Div:
+            case OpCode::Mod: {
+                int rhs = regs[ins.c].AsInt();
+                if (rhs == 0) {
+                    Error(function->origins[pc - 1], "division by zero");
+                }
+                int lhs = regs[ins.b].AsInt();
+                regs[ins.a] =
+                    Value::Int(ins.op == OpCode::Div ? lhs / rhs : lhs % rhs);
+                break;
+            }
+            case OpCode::Less:
+                regs[ins.a] =
+                    Value::Bool(regs[ins.b].AsInt() < regs[ins.c].AsInt());
+                break;
+            case OpCode::Greater:
+                regs[ins.a] =
+                    Value::Bool(regs[ins.b].AsInt() > regs[ins.c].AsInt());
+                break;
+            case OpCode::Equal:
+                regs[ins.a] = Value::Bool(regs[ins.b].Payload() ==
+                                          regs[ins.c].Payload());
+                break;
+            case OpCode::Jump:
+                pc = ins.a;
+                break;
+            case OpCode::JumpIfFalse:
+                if (!regs[ins.a].AsBool()) pc = ins.b;
+                break;
+            case OpCode::ArrayLoad: {
+                auto* array = ArrayOperand(regs[ins.b], function, pc);
+                try {
+                    regs[ins.a] = Value::Int(array->Load(regs[ins.c].AsInt()));
+                } catch (std::exception& ex) {
+                    Error(function->origins[pc - 1], ex.what());
+                }
+                break;
+            }
+            case OpCode::ArrayStore: {
+                auto* array = ArrayOperand(regs[ins.a], function, pc);
+                try {
+                    array->Store(regs[ins.b].AsInt(), regs[ins.c].AsInt());
+                } catch (std::exception& ex) {
+                    Error(function->origins[pc - 1], ex.what());
+                }
+                break;
+            }
+            case OpCode::ArrayLoadUnchecked: {
+                auto* array = ArrayOperand(regs[ins.b], function, pc);
+                regs[ins.a] =
+                    Value::Int(array->LoadUnchecked(regs[ins.c].AsInt()));
+                break;
+            }
+            case OpCode::ArrayStoreUnchecked: {
+                auto* array = ArrayOperand(regs[ins.a], function, pc);
+                array->StoreUnchecked(regs[ins.b].AsInt(), regs[ins.c].AsInt());
+                break;
+            }
+            case OpCode::Call:
+                frames_.push_back({function, pc, base, ins.a, pushed});
+                function = &module_.functions[ins.b];
+                base += ins.c;
+                pushed = ReserveFrame(base, function->frame_size);
+                regs = stack_.Data() + base;
+                code = function->code.data();
+                pc = 0;
+                break;
+            case OpCode::Return:
+            case OpCode::ReturnNone: {
+                Value result =
+                    ins.op == OpCode::Return ? regs[ins.a] : Value::None();
+                stack_.Pop(pushed);
+                if (frames_.empty()) return result;
+
+                const Frame& frame = frames_.back();
+                function = frame.function;
+                pc = frame.pc;
+                base = frame.base;
+                pushed = frame.pushed;
+                regs = stack_.Data() + base;
+                code = function->code.data();
+                regs[frame.dst] = std::move(result);
+                frames_.pop_back();
+                break;
+            }
+            case OpCode::Print:
+                regs[ins.a].Print(out_);
+                break;
+            case OpCode::Rand:
+                regs[ins.a] = Value::Int(rng_.Next());
+                break;
+        }
+    }
+}
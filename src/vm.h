@@ -0,0 +1,80 @@
+#pragma once
+
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "ast/ast.h"
+#include "bytecode.h"
+#include "frame_stack.h"
+#include "ir.h"
+#include "output_buffer.h"
+#include "random_generator.h"
+#include "value.h"
+
+// Executes bytecode produced by BytecodeCompiler. Frames are windows into a
+// single register stack; a callee frame starts at the first argument
+// register of its caller and only the part sticking out above the caller
+// is pushed.
+class VM {
+   public:
+    VM(const IR& ir, OutputBuffer& out) : ir_(ir), out_(out) {}
+
+    int Exec();
+
+    // Makes rand() return the same sequence on every run with this seed.
+    void SetSeed(uint64_t seed) { rng_.Seed(seed); }
+
+   private:
+    struct Frame {
+        const Bytecode::Function* function;
+        size_t pc;
+        size_t base;
+        int32_t dst;
+        // Registers pushed for the callee, popped on return.
+        size_t pushed;
+    };
+
+    Value Run(int function_index);
+
+    // Grows the register stack to cover [base, base + frame_size) and
+    // returns the number of registers pushed.
+    size_t ReserveFrame(size_t base, size_t frame_size) {
+        size_t end = base + frame_size;
+        if (end <= stack_.Size()) return 0;
+        size_t pushed = end - stack_.Size();
+        stack_.Push(pushed);
+        return pushed;
+    }
+
+    template <typename... Args>
+    void Error(const AST::ASTNode* node, Args... args) {
+        std::ostringstream oss;
+        oss << node->loc;
+        oss << ": ";
+        (oss << ... << args);
+        throw std::runtime_error(oss.str());
+    }
+
+    // Array held by the operand of the instruction before pc. A variable
+    // of array type declared without a size holds none.
+    ArrayObject* ArrayOperand(const Value& value,
+                              const Bytecode::Function* function, size_t pc) {
+        if (!value.IsArray()) {
+            Error(function->origins[pc - 1], "Not array object");
+        }
+        return value.AsArray();
+    }
+
+    IR ir_;
+    OutputBuffer& out_;
+
+    Bytecode::Module module_;
+
+    FrameStack<Value> stack_;
+    std::vector<Value> globals_;
+    std::vector<Frame> frames_;
+
+    RandomGenerator rng_;
+};
@@ -0,0 +1,279 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Minimal x86-64 machine code encoder used by the JIT. Only the instruction
+// forms the JIT needs are provided; memory operands are [base + disp32]
+// or, for array elements, [base + index * 4].
+namespace X86 {
+
+enum Reg : uint8_t {
+    RAX,
+    RCX,
+    RDX,
+    RBX,
+    RSP,
+    RBP,
+    RSI,
+    RDI,
+    R8,
+    R9,
+    R10,
+    R11,
+    R12,
+    R13,
+    R14,
+    R15,
+};
+
+// Condition codes as encoded in Jcc and SETcc.
+enum Cond : uint8_t {
+    AboveEqual = 0x3,
+    Equal = 0x4,
+    NotEqual = 0x5,
+    Sign = 0x8,
+    Less = 0xC,
+    GreaterEqual = 0xD,
+    LessEqual = 0xE,
+    Greater = 0xF,
+};
+
+inline Cond Negate(Cond cond) { return static_cast<Cond>(cond ^ 1); }
+
+class Emitter {
+   public:
+    using Label = int;
+
+    const std::vector<uint8_t>& Code() const { return code_; }
+
+    Label NewLabel() {
+        labels_.push_back(-1);
+        return labels_.size() - 1;
+    }
+
+    void Bind(Label label) {
+        labels_[label] = code_.size();
+        for (auto& fixup : fixups_) {
+            if (fixup.label == label) Patch(fixup.position, code_.size());
+        }
+    }
+
+    void Push(Reg reg) {
+        if (reg >= R8) Byte(0x41);
+        Byte(0x50 + (reg & 7));
+    }
+
+    void Pop(Reg reg) {
+        if (reg >= R8) Byte(0x41);
+        Byte(0x58 + (reg & 7));
+    }
+
+    // mov dst, src (64 bit)
+    void Mov64(Reg dst, Reg src) { RegReg(true, 0x89, src, dst); }
+    // mov dst, src (32 bit, zero-extends)
+    void Mov32(Reg dst, Reg src) { RegReg(false, 0x89, src, dst); }
+
+    // mov dst, imm32 (zero-extends)
+    void MovImm32(Reg dst, int32_t imm) {
+        if (dst >= R8) Byte(0x41);
+        Byte(0xB8 + (dst & 7));
+        Imm32(imm);
+    }
+
+    // mov dst, imm64
+    void MovImm64(Reg dst, uint64_t imm) {
+        Byte(0x48 | (dst >= R8 ? 1 : 0));
+        Byte(0xB8 + (dst & 7));
+        for (int i = 0; i < 8; ++i) Byte(imm >> (8 * i));
+    }
+
+    void Load32(Reg dst, Reg base, int32_t disp) {
+        Mem(false, 0x8B, dst, base, disp);
+    }
+    void Load64(Reg dst, Reg base, int32_t disp) {
+        Mem(true, 0x8B, dst, base, disp);
+    }
+    void Store32(Reg base, int32_t disp, Reg src) {
+        Mem(false, 0x89, src, base, disp);
+    }
+    void Store64(Reg base, int32_t disp, Reg src) {
+        Mem(true, 0x89, src, base, disp);
+    }
+    void Lea64(Reg dst, Reg base, int32_t disp) {
+        Mem(true, 0x8D, dst, base, disp);
+    }
+
+    // mov dst, dword ptr [base + index * 4]
+    void LoadIndexed32(Reg dst, Reg base, Reg index) {
+        Indexed(0x8B, dst, base, index);
+    }
+    // mov dword ptr [base + index * 4], src
+    void StoreIndexed32(Reg base, Reg index, Reg src) {
+        Indexed(0x89, src, base, index);
+    }
+
+    // mov byte ptr [base + disp], imm8
+    void StoreImm8(Reg base, int32_t disp, uint8_t imm) {
+        Mem(false, 0xC6, RAX, base, disp);
+        Byte(imm);
+    }
+    // mov dword ptr [base + disp], imm32
+    void StoreImm32(Reg base, int32_t disp, int32_t imm) {
+        Mem(false, 0xC7, RAX, base, disp);
+        Imm32(imm);
+    }
+
+    // cmp byte ptr [base + disp], imm8
+    void CmpImm8Byte(Reg base, int32_t disp, int8_t imm) {
+        Mem(false, 0x80, static_cast<Reg>(7), base, disp);
+        Byte(imm);
+    }
+    // cmp dword ptr [base + disp], imm8
+    void CmpImm8Dword(Reg base, int32_t disp, int8_t imm) {
+        Mem(false, 0x83, static_cast<Reg>(7), base, disp);
+        Byte(imm);
+    }
+
+    void Add32(Reg dst, Reg src) { RegReg(false, 0x01, src, dst); }
+    void Sub32(Reg dst, Reg src) { RegReg(false, 0x29, src, dst); }
+    void Cmp32(Reg lhs, Reg rhs) { RegReg(false, 0x39, rhs, lhs); }
+    void Test32(Reg lhs, Reg rhs) { RegReg(false, 0x85, rhs, lhs); }
+    void Test64(Reg lhs, Reg rhs) { RegReg(true, 0x85, rhs, lhs); }
+
+    void Imul32(Reg dst, Reg src) {
+        Rex(false, dst, src);
+        Byte(0x0F);
+        Byte(0xAF);
+        ModRM(3, dst, src);
+    }
+
+    // edx:eax = sign extension of eax
+    void Cdq() { Byte(0x99); }
+
+    // eax, edx = edx:eax / src, edx:eax % src
+    void Idiv32(Reg src) {
+        Rex(false, RAX, src);
+        Byte(0xF7);
+        ModRM(3, static_cast<Reg>(7), src);
+    }
+
+    // setcc al; movzx eax, al
+    void SetccEax(Cond cond) {
+        Byte(0x0F);
+        Byte(0x90 + cond);
+        ModRM(3, RAX, RAX);
+        Byte(0x0F);
+        Byte(0xB6);
+        ModRM(3, RAX, RAX);
+    }
+
+    void AndRspImm8(int8_t imm) {
+        Byte(0x48);
+        Byte(0x83);
+        ModRM(3, static_cast<Reg>(4), RSP);
+        Byte(imm);
+    }
+    void SubRsp(int32_t imm) {
+        Byte(0x48);
+        Byte(0x81);
+        ModRM(3, static_cast<Reg>(5), RSP);
+        Imm32(imm);
+    }
+    void AddRsp(int32_t imm) {
+        Byte(0x48);
+        Byte(0x81);
+        ModRM(3, RAX, RSP);
+        Imm32(imm);
+    }
+
+    void Call(Reg target) {
+        Rex(false, RAX, target);
+        Byte(0xFF);
+        ModRM(3, static_cast<Reg>(2), target);
+    }
+
+    void Ret() { Byte(0xC3); }
+
+    void Jmp(Label label) {
+        Byte(0xE9);
+        Fixup(label);
+    }
+
+    void Jcc(Cond cond, Label label) {
+        Byte(0x0F);
+        Byte(0x80 + cond);
+        Fixup(label);
+    }
+
+   private:
+    struct LabelFixup {
+        Label label;
+        size_t position;
+    };
+
+    void Byte(uint8_t byte) { code_.push_back(byte); }
+
+    void Imm32(int32_t imm) {
+        auto bits = static_cast<uint32_t>(imm);
+        for (int i = 0; i < 4; ++i) Byte(bits >> (8 * i));
+    }
+
+    void ModRM(uint8_t mod, Reg reg, Reg rm) {
+        Byte((mod << 6) | ((reg & 7) << 3) | (rm & 7));
+    }
+
+    void Rex(bool wide, Reg reg, Reg rm) {
+        uint8_t rex = 0x40 | (wide ? 8 : 0) | (reg >= R8 ? 4 : 0) |
+                      (rm >= R8 ? 1 : 0);
+        if (rex != 0x40) Byte(rex);
+    }
+
+    void RegReg(bool wide, uint8_t opcode, Reg reg, Reg rm) {
+        Rex(wide, reg, rm);
+        Byte(opcode);
+        ModRM(3, reg, rm);
+    }
+
+    void Mem(bool wide, uint8_t opcode, Reg reg, Reg base, int32_t disp) {
+        Rex(wide, reg, base);
+        Byte(opcode);
+        ModRM(2, reg, base);
+        if ((base & 7) == RSP) Byte(0x24);
+        Imm32(disp);
+    }
+
+    // [base + index * 4 + disp8 0]; the explicit displacement keeps rbp and
+    // r13 usable as base.
+    void Indexed(uint8_t opcode, Reg reg, Reg base, Reg index) {
+        uint8_t rex = 0x40 | (reg >= R8 ? 4 : 0) | (index >= R8 ? 2 : 0) |
+                      (base >= R8 ? 1 : 0);
+        if (rex != 0x40) Byte(rex);
+        Byte(opcode);
+        ModRM(1, reg, RSP);
+        Byte((2 << 6) | ((index & 7) << 3) | (base & 7));
+        Byte(0);
+    }
+
+    void Fixup(Label label) {
+        size_t position = code_.size();
+        Imm32(0);
+        if (labels_[label] >= 0) {
+            Patch(position, labels_[label]);
+        } else {
+            fixups_.push_back({label, position});
+        }
+    }
+
+    void Patch(size_t position, size_t target) {
+        int32_t rel = static_cast<int32_t>(target - (position + 4));
+        std::memcpy(&code_[position], &rel, sizeof(rel));
+    }
+
+    std::vector<uint8_t> code_;
+    std::vector<long> labels_;
+    std::vector<LabelFixup> fixups_;
+};
+
+}  // namespace X86
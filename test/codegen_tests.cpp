@@ -0,0 +1,237 @@
+#include <gtest/gtest.h>
+
+#include <sys/wait.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "asm_generator.h"
+#include "driver.h"
+#include "utils.h"
+
+class CodegenTests : public ::testing::Test {
+   protected:
+    void SetUp() override {
+#if !defined(__x86_64__) || !defined(__linux__)
+        GTEST_SKIP() << "native backend targets x86-64 Linux";
+#endif
+        if (std::system("cc --version > /dev/null 2>&1") != 0) {
+            GTEST_SKIP() << "no system C toolchain";
+        }
+        base_ = ::testing::TempDir() + "codegen_" +
+                ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    }
+
+    // Compiles the program to a native executable, runs it and returns its
+    // exit status; stdout and stderr are stored in out_ and err_.
+    int CompileAndRun(const std::string& source) {
+        std::istringstream iss(source);
+        Driver driver;
+        if (driver.Run(iss)) throw std::runtime_error("Driver run error");
+
+        {
+            std::ofstream asm_file(base_ + ".s");
+            AsmGenerator(driver.GetIR(), asm_file).Generate();
+        }
+
+        auto link = "cc -o " + base_ + " " + base_ + ".s";
+        if (std::system(link.c_str()) != 0) {
+            throw std::runtime_error("cc failed");
+        }
+
+        auto run = base_ + " > " + base_ + ".out 2> " + base_ + ".err";
+        int status = std::system(run.c_str());
+
+        out_ = ReadFile(base_ + ".out");
+        err_ = ReadFile(base_ + ".err");
+        return WEXITSTATUS(status);
+    }
+
+    static std::string ReadFile(const std::string& path) {
+        std::ifstream file(path);
+        std::ostringstream oss;
+        oss << file.rdbuf();
+        return oss.str();
+    }
+
+    std::string base_;
+    std::string out_;
+    std::string err_;
+};
+
+TEST_F(CodegenTests, WhileLoopGlobalArrayOK) {
+    EXPECT_EQ(CompileAndRun(R"(
+int a[1000];
+int main() {
+int s;
+s = 0;
+int k;
+k = 0;
+while (k < 30) {
+int i;
+i = 0;
+while (i < 1000) {
+a[i] = i + k;
+s = (s + a[i]) % 1000;
+i = i + 1;
+}
+k = k + 1;
+}
+print(s);
+print(" ");
+print(a[7]);
+return 0;
+})"),
+              0);
+    EXPECT_EQ(out_, "0 36");
+}
+
+TEST_F(CodegenTests, FunctionCallsOK) {
+    EXPECT_EQ(CompileAndRun(R"(
+int sum7(int a, int b, int c, int d, int e, int f, int g) {
+return a + b * 2 + c * 3 + d * 4 + e * 5 + f * 6 + g * 7;
+}
+int fib(int n) {
+if (n < 2) return n;
+return fib(n - 1) + fib(n - 2);
+}
+int total(int[5] xs) {
+int s;
+s = 0;
+int i;
+i = 0;
+while (i < 5) {
+s = s + xs[i];
+i = i + 1;
+}
+return s;
+}
+bool less(int a, int b) {
+return a < b;
+}
+void main() {
+int loc[5];
+int i;
+i = 0;
+while (i < 5) {
+loc[i] = i * i;
+i = i + 1;
+}
+print(total(loc));
+print(" ");
+print(sum7(1, 2, 3, 4, 5, 6, fib(7)));
+print(" ");
+print(17 / 5);
+print(17 % 5);
+print(less(3, 4));
+print(less(4, 3));
+})"),
+              0);
+    EXPECT_EQ(out_, "30 182 3210");
+}
+
+TEST_F(CodegenTests, PrintStringOK) {
+    EXPECT_EQ(CompileAndRun(R"(
+void main() {
+print("\"100%\"\t\\\n");
+})"),
+              0);
+    EXPECT_EQ(out_, "\"100%\"\t\\\n");
+}
+
+TEST_F(CodegenTests, MainExitStatusOK) {
+    EXPECT_EQ(CompileAndRun(R"(int main() { return 7; })"), 7);
+}
+
+TEST_F(CodegenTests, ArrayOutOfBoundsFail) {
+    EXPECT_EQ(CompileAndRun(R"(
+int main() {
+int a[3];
+int i;
+i = 3;
+print(a[i]);
+return 0;
+})"),
+              1);
+    EXPECT_EQ(err_, "6:8: array access 3 out of bounds 3\n");
+}
+
+TEST_F(CodegenTests, DivisionByZeroFail) {
+    EXPECT_EQ(CompileAndRun(R"(
+int main() {
+int z;
+z = 0;
+print(1 / z);
+return 0;
+})"),
+              1);
+    EXPECT_EQ(err_, "5:9: division by zero\n");
+}
+
+TEST_F(CodegenTests, ArrayAssignmentFail) {
+    ExpectThrow(CompileAndRun(R"(
+int g[4];
+void main() {
+int l[4];
+g = l;
+})"),
+                "5:3: assigning arrays is not supported by the native "
+                "backend");
+}
+
+TEST_F(CodegenTests, ArrayWithoutSizeFail) {
+    ExpectThrow(CompileAndRun(R"(void main() {
+int[10] x;
+x[0] = 5;
+})"),
+                "2:1: array 'x' has no size");
+
+    // Nothing is written before the error.
+    std::istringstream iss(R"(
+void f() { print(1); }
+int[10] g;
+void main() { print(g[0]); })");
+    Driver driver;
+    ASSERT_EQ(driver.Run(iss), 0);
+    std::ostringstream oss;
+    ExpectThrow(AsmGenerator(driver.GetIR(), oss).Generate(),
+                "3:1: array 'g' has no size");
+    EXPECT_EQ(oss.str(), "");
+}
+
+TEST_F(CodegenTests, UninitializedVariableFail) {
+    EXPECT_EQ(CompileAndRun(R"(void main() { int x; print(x); })"), 1);
+    EXPECT_EQ(err_, "1:28: Variable x uninitialized\n");
+
+    // Assigned on one path only, then declared again in a loop.
+    EXPECT_EQ(CompileAndRun(R"(
+int g;
+void main() {
+int i;
+i = 0;
+if (rand() < 0) {
+g = 1;
+}
+while (i < 2) {
+int x;
+if (i == 0) {
+x = 5;
+}
+print(x);
+i = i + 1;
+}
+})"),
+              1);
+    EXPECT_EQ(out_, "5");
+    EXPECT_EQ(err_, "14:7: Variable x uninitialized\n");
+
+    EXPECT_EQ(CompileAndRun(R"(
+int g;
+void main() {
+print(g + 1);
+})"),
+              1);
+    EXPECT_EQ(err_, "4:7: Variable g uninitialized\n");
+}
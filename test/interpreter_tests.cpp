@@ -1,28 +1,60 @@
 #include <gtest/gtest.h>
+#include <unistd.h>
 
+#include <atomic>
+#include <cstdio>
+#include <fstream>
 #include <memory>
 #include <sstream>
 
 #include "ast/function.h"
 #include "ast/program.h"
 #include "ast/type.h"
+#include "backend.h"
+#include "batch_runner.h"
 #include "driver.h"
 #include "interpreter.h"
+#include "output_buffer.h"
+#include "random_generator.h"
+#include "sampling_profiler.h"
+#include "stats.h"
+#include "thread_pool.h"
 #include "utils.h"
 
-class InterpreterTests : public ::testing::Test {
+class InterpreterTests : public ::testing::TestWithParam<Backend> {
    protected:
     void Exec(std::istringstream& iss, std::ostringstream& oss) {
         Driver driver;
         auto res = driver.Run(iss);
         if (res) throw std::runtime_error("Driver run error");
 
-        Interpreter interpreter(driver.GetIR(), oss);
-        interpreter.Exec();
+        if (GetParam() == Backend::Jit) {
+            // Compile every supported function before its first call.
+            OutputBuffer out(oss);
+            Interpreter interpreter(driver.GetIR(), out);
+            interpreter.EnableJit(0);
+            interpreter.Exec();
+            return;
+        }
+        Execute(GetParam(), driver.GetIR(), oss);
     }
 };
 
-TEST_F(InterpreterTests, SimpleVoidMainOK) {
+INSTANTIATE_TEST_SUITE_P(Backends, InterpreterTests,
+                         ::testing::Values(Backend::TreeWalker,
+                                           Backend::Bytecode, Backend::Jit),
+                         [](const ::testing::TestParamInfo<Backend>& info) {
+                             switch (info.param) {
+                                 case Backend::Bytecode:
+                                     return "Bytecode";
+                                 case Backend::Jit:
+                                     return "Jit";
+                                 default:
+                                     return "TreeWalker";
+                             }
+                         });
+
+TEST_P(InterpreterTests, SimpleVoidMainOK) {
     std::istringstream iss(R"(void main() {})");
 
     std::ostringstream oss;
@@ -32,7 +64,7 @@ TEST_F(InterpreterTests, SimpleVoidMainOK) {
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, SimpleIntMainOK) {
+TEST_P(InterpreterTests, SimpleIntMainOK) {
     std::istringstream iss(R"(int main() {return 0;})");
 
     std::ostringstream oss;
@@ -42,7 +74,7 @@ TEST_F(InterpreterTests, SimpleIntMainOK) {
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, PrintIntLiteralOK) {
+TEST_P(InterpreterTests, PrintIntLiteralOK) {
     std::istringstream iss(R"(void main() {
 print (1);
 })");
@@ -54,7 +86,7 @@ print (1);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, PrintStringLiteralOK) {
+TEST_P(InterpreterTests, PrintStringLiteralOK) {
     std::istringstream iss(R"(void main() {
 print ("1");
 })");
@@ -66,7 +98,7 @@ print ("1");
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, PrintBoolLiteralTrueOK) {
+TEST_P(InterpreterTests, PrintBoolLiteralTrueOK) {
     std::istringstream iss(R"(void main() {
 print (true);
 })");
@@ -78,7 +110,7 @@ print (true);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, PrintBoolLiteralFalseOK) {
+TEST_P(InterpreterTests, PrintBoolLiteralFalseOK) {
     std::istringstream iss(R"(void main() {
 print (false);
 })");
@@ -90,7 +122,7 @@ print (false);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, PrintEscapeSymbolsOK) {
+TEST_P(InterpreterTests, PrintEscapeSymbolsOK) {
     std::istringstream iss(R"(void main() {
 print ("\n\033\n\t\034\n\x13\7");
 })");
@@ -102,7 +134,7 @@ print ("\n\033\n\t\034\n\x13\7");
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, AccessIntVarOK) {
+TEST_P(InterpreterTests, AccessIntVarOK) {
     std::istringstream iss(R"(void main() {
 int i;
 i = 1;
@@ -116,7 +148,7 @@ print (i);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, AccessIntVarWithoutInitializationFail) {
+TEST_P(InterpreterTests, AccessIntVarWithoutInitializationFail) {
     std::istringstream iss(R"(void main() {
 int i;
 print (i);
@@ -126,7 +158,7 @@ print (i);
     ExpectThrow(Exec(iss, oss), "3:8: Variable i uninitialized");
 }
 
-TEST_F(InterpreterTests, AccessIntArrayOK) {
+TEST_P(InterpreterTests, AccessIntArrayOK) {
     std::istringstream iss(R"(void main() {
 int i[10];
 i[0] = 1;
@@ -140,17 +172,19 @@ print (i[0]);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, AccessIntArrayWithoutInitializationFail) {
+TEST_P(InterpreterTests, AccessIntArrayWithoutInitializationOK) {
     std::istringstream iss(R"(void main() {
 int i[10];
-print (i[0]);
+print (i[9]);
 })");
 
     std::ostringstream oss;
-    ExpectThrow(Exec(iss, oss), "3:9: array access 0 out of bounds 0");
+    EXPECT_NO_THROW(Exec(iss, oss));
+
+    EXPECT_EQ(oss.str(), "0");
 }
 
-TEST_F(InterpreterTests, AccessIntArrayOutOfAssignedBoundsFail) {
+TEST_P(InterpreterTests, AccessIntArrayPastAssignedElementsOK) {
     std::istringstream iss(R"(void main() {
 int i[10];
 i[0] = 0;
@@ -158,10 +192,92 @@ print (i[1]);
 })");
 
     std::ostringstream oss;
-    ExpectThrow(Exec(iss, oss), "4:9: array access 1 out of bounds 1");
+    EXPECT_NO_THROW(Exec(iss, oss));
+
+    EXPECT_EQ(oss.str(), "0");
+}
+
+TEST_P(InterpreterTests, AccessIntArrayOutOfBoundsFail) {
+    std::istringstream iss(R"(void main() {
+int i[10];
+int k;
+k = rand() % 1 + 10;
+print (i[k]);
+})");
+
+    std::ostringstream oss;
+    ExpectThrow(Exec(iss, oss), "5:9: array access 10 out of bounds 10");
+}
+
+TEST_P(InterpreterTests, AssignIntArrayOutOfBoundsFail) {
+    std::istringstream iss(R"(void main() {
+int i[10];
+int k;
+k = rand() % 1 - 1;
+i[k] = 1;
+})");
+
+    std::ostringstream oss;
+    ExpectThrow(Exec(iss, oss), "5:6: array access -1 out of bounds 10");
+}
+
+TEST_P(InterpreterTests, AssignArrayWithoutStorageFail) {
+    std::istringstream iss(R"(void main() {
+int[10] x;
+x[0] = 5;
+})");
+
+    std::ostringstream oss;
+    ExpectThrow(Exec(iss, oss), "3:6: Not array object");
+}
+
+TEST_P(InterpreterTests, AccessGlobalArrayWithoutStorageFail) {
+    std::istringstream iss(R"(int[10] g;
+void main() {
+int i;
+int s;
+i = 0;
+s = 0;
+while (i < 10) {
+s = s + g[i];
+i = i + 1;
+}
+print(s);
+})");
+
+    std::ostringstream oss;
+    ExpectThrow(Exec(iss, oss), "8:10: Not array object");
+}
+
+TEST_P(InterpreterTests, CountedLoopArrayAccessOK) {
+    std::istringstream iss(R"(
+int a[12];
+void main() {
+int b[4];
+int i;
+int j;
+j = 0;
+while (j < 3) {
+i = 0;
+while (i < 4) {
+a[i + j * 4] = i * j;
+b[i] = b[i] + a[i + j * 4];
+i = i + 1;
+}
+j = j + 1;
+}
+print(b[3]);
+print(" ");
+print(a[11]);
+})");
+
+    std::ostringstream oss;
+    EXPECT_NO_THROW(Exec(iss, oss));
+
+    EXPECT_EQ(oss.str(), "9 6");
 }
 
-TEST_F(InterpreterTests, PrintArrayFail) {
+TEST_P(InterpreterTests, PrintArrayFail) {
     std::istringstream iss(R"(void main() {
 int i[10];
 print (i);
@@ -171,7 +287,7 @@ print (i);
     ExpectThrow(Exec(iss, oss), "call ArrayObject Print");
 }
 
-TEST_F(InterpreterTests, FuncCallWithOneArgumentOK) {
+TEST_P(InterpreterTests, FuncCallWithOneArgumentOK) {
     std::istringstream iss(R"(void foo(int i) {
 print (i);
 }
@@ -186,7 +302,7 @@ foo(1);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, FuncCallWithMultipleArgumentsOK) {
+TEST_P(InterpreterTests, FuncCallWithMultipleArgumentsOK) {
     std::istringstream iss(R"(void foo(int i, int j, bool b) {
 print (i);
 print (j);
@@ -203,7 +319,7 @@ foo(3, 2, true);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, FuncCallPrematureReturnOK) {
+TEST_P(InterpreterTests, FuncCallPrematureReturnOK) {
     std::istringstream iss(R"(
 void main() {
 print (1);
@@ -219,7 +335,7 @@ print(2);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, FuncCallReturnResultOK) {
+TEST_P(InterpreterTests, FuncCallReturnResultOK) {
     std::istringstream iss(R"(
 int foo() { return 1; }
 void main() {
@@ -234,7 +350,7 @@ print(foo());
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, FuncCallReturnResultFromIfThenElseTrueOK) {
+TEST_P(InterpreterTests, FuncCallReturnResultFromIfThenElseTrueOK) {
     std::istringstream iss(R"(
 int foo() {
 if(true) return 1; else return 2;
@@ -252,7 +368,7 @@ print(foo());
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, FuncCallReturnResultFromIfThenElseFalseOK) {
+TEST_P(InterpreterTests, FuncCallReturnResultFromIfThenElseFalseOK) {
     std::istringstream iss(R"(
 int foo() {
 if(false) return 1; else return 2;
@@ -270,7 +386,33 @@ print(foo());
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, FuncCallReturnResultFromWhileOK) {
+TEST_P(InterpreterTests, FuncCallReturnFromWhileInsideIfOK) {
+    std::istringstream iss(R"(
+int foo(int n) {
+if (n > 0) {
+while (true) {
+if (n > 5) return n;
+n = n + 1;
+print(n);
+}
+}
+return 0;
+}
+void main() {
+print(foo(3));
+print(" ");
+print(foo(0));
+}
+)");
+
+    std::ostringstream oss;
+    EXPECT_NO_THROW(Exec(iss, oss));
+
+    // Nothing after the return runs, in the loop body or after the loop.
+    EXPECT_EQ(oss.str(), "4566 0");
+}
+
+TEST_P(InterpreterTests, FuncCallReturnResultFromWhileOK) {
     std::istringstream iss(R"(
 int foo() {
 while(true) {
@@ -290,7 +432,7 @@ print(foo());
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ArithOpPlusIntLiteralIntLiteralOK) {
+TEST_P(InterpreterTests, ArithOpPlusIntLiteralIntLiteralOK) {
     std::istringstream iss(R"(void main() {
 print(1 + 2);
 })");
@@ -302,7 +444,7 @@ print(1 + 2);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ArithOpMinusIntLiteralIntLiteralOK) {
+TEST_P(InterpreterTests, ArithOpMinusIntLiteralIntLiteralOK) {
     std::istringstream iss(R"(void main() {
 print(10 - 2);
 })");
@@ -314,7 +456,7 @@ print(10 - 2);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ArithOpMultiplyIntLiteralIntLiteralOK) {
+TEST_P(InterpreterTests, ArithOpMultiplyIntLiteralIntLiteralOK) {
     std::istringstream iss(R"(void main() {
 print(3 * 2);
 })");
@@ -326,7 +468,7 @@ print(3 * 2);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ArithOpDivideIntLiteralIntLiteralOK) {
+TEST_P(InterpreterTests, ArithOpDivideIntLiteralIntLiteralOK) {
     std::istringstream iss(R"(void main() {
 print(10 / 2);
 })");
@@ -338,7 +480,7 @@ print(10 / 2);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ArithOpModIntLiteralIntLiteralOK) {
+TEST_P(InterpreterTests, ArithOpModIntLiteralIntLiteralOK) {
     std::istringstream iss(R"(void main() {
 print(13 % 2);
 })");
@@ -350,7 +492,7 @@ print(13 % 2);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ArithOpPlusIntVarIntLiteralOK) {
+TEST_P(InterpreterTests, ArithOpPlusIntVarIntLiteralOK) {
     std::istringstream iss(R"(void main() {
 int i;
 i = 1;
@@ -364,7 +506,7 @@ print(i + 2);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ArithOpPrecedencePlusMultiplyRightOK) {
+TEST_P(InterpreterTests, ArithOpPrecedencePlusMultiplyRightOK) {
     std::istringstream iss(R"(void main() {
 print(1 + 2 * 10);
 })");
@@ -376,7 +518,7 @@ print(1 + 2 * 10);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ArithOpPrecedencePlusMultiplyLeftOK) {
+TEST_P(InterpreterTests, ArithOpPrecedencePlusMultiplyLeftOK) {
     std::istringstream iss(R"(void main() {
 print(2 * 10 + 1);
 })");
@@ -388,7 +530,7 @@ print(2 * 10 + 1);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ArithOpPrecedencePlusDivideOK) {
+TEST_P(InterpreterTests, ArithOpPrecedencePlusDivideOK) {
     std::istringstream iss(R"(void main() {
 print(2 + 10 / 2);
 })");
@@ -400,7 +542,7 @@ print(2 + 10 / 2);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ArithOpPrecedencePlusModOK) {
+TEST_P(InterpreterTests, ArithOpPrecedencePlusModOK) {
     std::istringstream iss(R"(void main() {
 print(2 + 10 % 4);
 })");
@@ -412,7 +554,7 @@ print(2 + 10 % 4);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ArithOpTriplePlusOK) {
+TEST_P(InterpreterTests, ArithOpTriplePlusOK) {
     std::istringstream iss(R"(void main() {
 print(1 + 2 + 3);
 })");
@@ -424,7 +566,7 @@ print(1 + 2 + 3);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ArithOpTripleMultiplyDivideOK) {
+TEST_P(InterpreterTests, ArithOpTripleMultiplyDivideOK) {
     std::istringstream iss(R"(void main() {
 print(2 * 10 / 4);
 })");
@@ -436,7 +578,7 @@ print(2 * 10 / 4);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ArithOpIntDivideWithoutRoundOK) {
+TEST_P(InterpreterTests, ArithOpIntDivideWithoutRoundOK) {
     std::istringstream iss(R"(void main() {
 print(10 / 5);
 })");
@@ -448,7 +590,7 @@ print(10 / 5);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ArithOpIntDivideWithRoundCeilOK) {
+TEST_P(InterpreterTests, ArithOpIntDivideWithRoundCeilOK) {
     std::istringstream iss(R"(void main() {
 print(18 / 10);
 })");
@@ -460,7 +602,7 @@ print(18 / 10);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ArithOpIntDivideWithRoundFloorOK) {
+TEST_P(InterpreterTests, ArithOpIntDivideWithRoundFloorOK) {
     std::istringstream iss(R"(void main() {
 print(11 / 10);
 })");
@@ -472,7 +614,7 @@ print(11 / 10);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ArithOpIntDivideZeroFail) {
+TEST_P(InterpreterTests, ArithOpIntDivideZeroFail) {
     std::istringstream iss(R"(void main() {
 print(11 / 0);
 })");
@@ -481,7 +623,16 @@ print(11 / 0);
     ExpectThrow(Exec(iss, oss), "2:10: division by zero");
 }
 
-TEST_F(InterpreterTests, LogicOpLessIntLiteralIntLiteralTrueOK) {
+TEST_P(InterpreterTests, ArithOpIntModZeroFail) {
+    std::istringstream iss(R"(void main() {
+print(11 % 0);
+})");
+
+    std::ostringstream oss;
+    ExpectThrow(Exec(iss, oss), "2:10: division by zero");
+}
+
+TEST_P(InterpreterTests, LogicOpLessIntLiteralIntLiteralTrueOK) {
     std::istringstream iss(R"(void main() {
 print(1 < 2);
 })");
@@ -493,7 +644,7 @@ print(1 < 2);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, LogicOpLessIntLiteralIntLiteralFalseOK) {
+TEST_P(InterpreterTests, LogicOpLessIntLiteralIntLiteralFalseOK) {
     std::istringstream iss(R"(void main() {
 print(1 > 2);
 })");
@@ -505,7 +656,7 @@ print(1 > 2);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, LogicOpGreaterIntLiteralIntLiteralTrueOK) {
+TEST_P(InterpreterTests, LogicOpGreaterIntLiteralIntLiteralTrueOK) {
     std::istringstream iss(R"(void main() {
 print(10 > 2);
 })");
@@ -517,7 +668,7 @@ print(10 > 2);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, LogicOpGreaterIntLiteralIntLiteralFalseOK) {
+TEST_P(InterpreterTests, LogicOpGreaterIntLiteralIntLiteralFalseOK) {
     std::istringstream iss(R"(void main() {
 print(10 < 2);
 })");
@@ -529,7 +680,7 @@ print(10 < 2);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, LogicOpLessIntVarIntLiteralOK) {
+TEST_P(InterpreterTests, LogicOpLessIntVarIntLiteralOK) {
     std::istringstream iss(R"(void main() {
 int i;
 i = 1;
@@ -543,7 +694,7 @@ print(i < 2);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, LogicOpEqualIntVarIntLiteralTrueOK) {
+TEST_P(InterpreterTests, LogicOpEqualIntVarIntLiteralTrueOK) {
     std::istringstream iss(R"(void main() {
 int i;
 i = 1;
@@ -557,7 +708,7 @@ print(i == 1);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, LogicOpEqualIntVarIntLiteralFalseOK) {
+TEST_P(InterpreterTests, LogicOpEqualIntVarIntLiteralFalseOK) {
     std::istringstream iss(R"(void main() {
 int i;
 i = 1;
@@ -571,7 +722,22 @@ print(i == 2);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ArithOpLogicOpPrecedenceOK) {
+TEST_P(InterpreterTests, LogicOpEqualBoolOK) {
+    std::istringstream iss(R"(void main() {
+bool b;
+b = 1 < 2;
+print(b == true);
+print(b == false);
+})");
+
+    std::ostringstream oss;
+    EXPECT_NO_THROW(Exec(iss, oss));
+
+    const std::string expected(R"(10)");
+    EXPECT_EQ(oss.str(), expected);
+}
+
+TEST_P(InterpreterTests, ArithOpLogicOpPrecedenceOK) {
     std::istringstream iss(R"(void main() {
 print(1 + 1 < 2 + 3);
 })");
@@ -583,7 +749,7 @@ print(1 + 1 < 2 + 3);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ArithOpLogicOpPrecedenceFail) {
+TEST_P(InterpreterTests, ArithOpLogicOpPrecedenceFail) {
     std::istringstream iss(R"(void main() {
 print(1 + 1 > 2 + 3);
 })");
@@ -595,7 +761,7 @@ print(1 + 1 > 2 + 3);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ArithOpParenthesesPrecedenceOK) {
+TEST_P(InterpreterTests, ArithOpParenthesesPrecedenceOK) {
     std::istringstream iss(R"(void main() {
 print((2 + 3) * 2);
 })");
@@ -607,7 +773,7 @@ print((2 + 3) * 2);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ReassignIntVarOK) {
+TEST_P(InterpreterTests, ReassignIntVarOK) {
     std::istringstream iss(R"(void main() {
 int i;
 i = 1;
@@ -623,7 +789,7 @@ print(i);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, HideIntVarWithFunctionOK) {
+TEST_P(InterpreterTests, HideIntVarWithFunctionOK) {
     std::istringstream iss(R"(void foo(int i) {
 i = 2;
 print (i);
@@ -643,7 +809,27 @@ print(i);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, HideIntVarWithWhileOK) {
+TEST_P(InterpreterTests, GlobalNotHiddenByCallerLocalOK) {
+    std::istringstream iss(R"(int g;
+void show() {
+print(g);
+}
+void main() {
+g = 1;
+int g;
+g = 2;
+show();
+print(g);
+})");
+
+    std::ostringstream oss;
+    EXPECT_NO_THROW(Exec(iss, oss));
+
+    const std::string expected(R"(12)");
+    EXPECT_EQ(oss.str(), expected);
+}
+
+TEST_P(InterpreterTests, HideIntVarWithWhileOK) {
     std::istringstream iss(R"(void main() {
 int i;
 i = 1;
@@ -669,7 +855,7 @@ print(j);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, HideIntVarWithIfThenOK) {
+TEST_P(InterpreterTests, HideIntVarWithIfThenOK) {
     std::istringstream iss(R"(void main() {
 int i;
 i = 1;
@@ -701,7 +887,7 @@ print(j);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, HideIntVarWithIfThenElseOK) {
+TEST_P(InterpreterTests, HideIntVarWithIfThenElseOK) {
     std::istringstream iss(R"(void main() {
 int i;
 i = 1;
@@ -733,7 +919,7 @@ print(j);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, ReassignIntArrayOK) {
+TEST_P(InterpreterTests, ReassignIntArrayOK) {
     std::istringstream iss(R"(void main() {
 int i[10];
 i[0] = 1;
@@ -749,7 +935,7 @@ print(i[0]);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, IfThenTrueOK) {
+TEST_P(InterpreterTests, IfThenTrueOK) {
     std::istringstream iss(R"(void main() {
 if(1 < 2) print (1);
 })");
@@ -761,7 +947,7 @@ if(1 < 2) print (1);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, IfThenFalseOK) {
+TEST_P(InterpreterTests, IfThenFalseOK) {
     std::istringstream iss(R"(void main() {
 if(1 > 2) print (1);
 })");
@@ -773,7 +959,7 @@ if(1 > 2) print (1);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, IfThenElseOK) {
+TEST_P(InterpreterTests, IfThenElseOK) {
     std::istringstream iss(R"(void main() {
 if(1 > 2) print (1);
 else print (2);
@@ -786,7 +972,7 @@ else print (2);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, IfThenElseManyStatementsOK) {
+TEST_P(InterpreterTests, IfThenElseManyStatementsOK) {
     std::istringstream iss(R"(void main() {
 if(1 < 2) {
 print (1);
@@ -804,7 +990,7 @@ print (4);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, IfThenElseManyStatementsElseOK) {
+TEST_P(InterpreterTests, IfThenElseManyStatementsElseOK) {
     std::istringstream iss(R"(void main() {
 if(1 > 2) {
 print (1);
@@ -822,7 +1008,7 @@ print (4);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, IfThenElsePrematureReturnOK) {
+TEST_P(InterpreterTests, IfThenElsePrematureReturnOK) {
     std::istringstream iss(R"(void main() {
 print(1);
 if(true) {
@@ -843,7 +1029,7 @@ print(6);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, IfThenElsePrematureReturnElseOK) {
+TEST_P(InterpreterTests, IfThenElsePrematureReturnElseOK) {
     std::istringstream iss(R"(void main() {
 print(1);
 if(false) {
@@ -863,7 +1049,7 @@ print(5);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, WhileFalseConditionOK) {
+TEST_P(InterpreterTests, WhileFalseConditionOK) {
     std::istringstream iss(R"(void main() {
 while(false) {
 print (1);
@@ -877,7 +1063,7 @@ print (1);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, WhileLoopOK) {
+TEST_P(InterpreterTests, WhileLoopOK) {
     std::istringstream iss(R"(void main() {
 int i;
 i = 1;
@@ -894,7 +1080,7 @@ i = i + 1;
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, WhilePrematureReturnOK) {
+TEST_P(InterpreterTests, WhilePrematureReturnOK) {
     std::istringstream iss(R"(void main() {
 int i;
 i = 1;
@@ -913,7 +1099,7 @@ print (9);
     EXPECT_EQ(oss.str(), expected);
 }
 
-TEST_F(InterpreterTests, RandOK) {
+TEST_P(InterpreterTests, RandOK) {
     std::istringstream iss(R"(void main() {
 print ((rand() % 10) < 10);
 })");
@@ -924,3 +1110,664 @@ print ((rand() % 10) < 10);
     const std::string expected(R"(1)");
     EXPECT_EQ(oss.str(), expected);
 }
+
+TEST(RandomGeneratorTests, SeededSequenceOK) {
+    RandomGenerator first(42);
+    RandomGenerator second(42);
+    RandomGenerator other(43);
+    bool differs = false;
+    for (int i = 0; i < 1000; ++i) {
+        auto value = first.Next();
+        EXPECT_GE(value, 0);
+        EXPECT_LE(value, RandomGenerator::kMax);
+        EXPECT_EQ(value, second.Next());
+        differs |= value != other.Next();
+    }
+    EXPECT_TRUE(differs);
+
+    first.Seed(42);
+    second.Seed(42);
+    EXPECT_EQ(first.Next(), second.Next());
+}
+
+TEST(RandomGeneratorTests, SeededProgramOK) {
+    std::string source = R"(void main() {
+int i;
+i = 0;
+while (i < 100) {
+print (rand() % 1000);
+print (" ");
+i = i + 1;
+}
+})";
+    auto run = [&source](Backend backend, uint64_t seed) {
+        std::istringstream iss(source);
+        Driver driver;
+        driver.SetSeed(seed);
+        EXPECT_EQ(driver.Run(iss), 0);
+        std::ostringstream oss;
+        OutputBuffer out(oss);
+        driver.Execute(backend, out);
+        out.Flush();
+        return oss.str();
+    };
+
+    auto expected = run(Backend::TreeWalker, 7);
+    EXPECT_EQ(run(Backend::TreeWalker, 7), expected);
+    EXPECT_EQ(run(Backend::Bytecode, 7), expected);
+    EXPECT_EQ(run(Backend::Jit, 7), expected);
+    EXPECT_NE(run(Backend::TreeWalker, 8), expected);
+}
+
+TEST_P(InterpreterTests, RecursiveFuncCallOK) {
+    std::istringstream iss(R"(
+int fib(int n) {
+if (n < 2) return n;
+return fib(n - 1) + fib(n - 2);
+}
+void main() {
+print(fib(10));
+})");
+
+    std::ostringstream oss;
+    EXPECT_NO_THROW(Exec(iss, oss));
+
+    const std::string expected(R"(55)");
+    EXPECT_EQ(oss.str(), expected);
+}
+
+TEST_P(InterpreterTests, GlobalArrayAccessFromFunctionOK) {
+    std::istringstream iss(R"(
+int a[10];
+void fill(int n) {
+int i;
+i = 0;
+while (i < n) {
+a[i] = i * i;
+i = i + 1;
+}
+}
+void main() {
+fill(4);
+print(a[3]);
+print(a[2] + a[1]);
+})");
+
+    std::ostringstream oss;
+    EXPECT_NO_THROW(Exec(iss, oss));
+
+    const std::string expected(R"(95)");
+    EXPECT_EQ(oss.str(), expected);
+}
+
+TEST_P(InterpreterTests, GlobalArrayReassignedAfterTierUpOK) {
+    // Compiled functions must see the array assigned to the global, not
+    // the one it held when they were compiled.
+    std::istringstream iss(R"(
+int g[4];
+int f(int i) { return g[i]; }
+void set(int i, int v) { g[i] = v; }
+void main() {
+int l[4];
+int i;
+int r;
+l[0] = 42;
+i = 0;
+while (i < 300) {
+if (i == 250) {
+g = l;
+}
+r = f(0);
+i = i + 1;
+}
+print(r);
+set(1, 7);
+print(l[1]);
+})");
+
+    std::ostringstream oss;
+    EXPECT_NO_THROW(Exec(iss, oss));
+
+    EXPECT_EQ(oss.str(), "427");
+}
+
+TEST_P(InterpreterTests, NestedCallArgumentsOK) {
+    std::istringstream iss(R"(
+int sub(int a, int b) {
+int d;
+d = a - b;
+return d;
+}
+int sum(int n) {
+if (n == 0) return 0;
+return n + sum(n - 1);
+}
+void main() {
+print(sub(sub(10, 3), sub(sum(1000), 500497)));
+})");
+
+    std::ostringstream oss;
+    EXPECT_NO_THROW(Exec(iss, oss));
+
+    const std::string expected(R"(4)");
+    EXPECT_EQ(oss.str(), expected);
+}
+
+TEST_P(InterpreterTests, InlinedFunctionsOK) {
+    std::istringstream iss(R"(
+int g;
+int sign(int x) {
+if (x < 0) {
+if (x < 0 - 100) return 0 - 2;
+return 0 - 1;
+} else {
+if (x == 0) return 0;
+}
+return 1;
+}
+int bump(int x) {
+g = g + x;
+return g;
+}
+int trace(int x) {
+print("m");
+return x;
+}
+void show(int x) {
+int y;
+y = x * 2;
+print(y);
+print(" ");
+}
+void main() {
+int x;
+x = 5;
+g = 0;
+print(sign(0 - 500) + sign(0 - 3) * 10 + sign(0) + sign(x) * 100);
+print(" ");
+print(g + bump(x) + bump(1));
+print(" ");
+show(x);
+print(x);
+print(" ");
+print(trace(5));
+int a[4];
+a[trace(1)] = 7;
+print(a[trace(1)]);
+a[trace(2)] = trace(3);
+print(a[2]);
+}
+)");
+
+    std::ostringstream oss;
+    EXPECT_NO_THROW(Exec(iss, oss));
+
+    EXPECT_EQ(oss.str(), "88 11 10 5 m5mm7mm3");
+}
+
+TEST(JitTierUpTests, HotLeafFunctionCompiledOK) {
+    std::istringstream iss(R"(
+int a[8];
+int blur(int offset) {
+int circ[2];
+circ[0] = a[offset];
+circ[1] = a[offset + 1];
+return (circ[0] + circ[1]) / 2;
+}
+bool odd(int n) {
+return n % 2 == 1;
+}
+void main() {
+int i;
+i = 0;
+while (i < 8) {
+a[i] = i * 10;
+i = i + 1;
+}
+int s;
+s = 0;
+i = 0;
+while (i < 50) {
+s = s + blur(i % 7);
+if (odd(i)) s = s - 1;
+i = i + 1;
+}
+print(s);
+})");
+
+    // Keep odd as a separate function to be tiered up.
+    Driver driver;
+    driver.SetInlineBudget(0);
+    ASSERT_EQ(driver.Run(iss), 0);
+
+    std::ostringstream oss;
+    OutputBuffer out(oss);
+    Interpreter interpreter(driver.GetIR(), out);
+    interpreter.EnableJit(10);
+    EXPECT_NO_THROW(interpreter.Exec());
+    out.Flush();
+
+    EXPECT_EQ(oss.str(), "1695");
+    EXPECT_EQ(interpreter.JitCompiledCount(), 2);
+}
+
+TEST(JitTierUpTests, ArrayWithoutStorageFail) {
+    // A hot function indexing a local or a global array declared without
+    // a size must fail like the interpreter does, not crash.
+    auto run = [](const std::string& source, int compiled) {
+        std::istringstream iss(source);
+        Driver driver;
+        driver.SetInlineBudget(0);
+        EXPECT_EQ(driver.Run(iss), 0);
+
+        std::ostringstream oss;
+        OutputBuffer out(oss);
+        Interpreter interpreter(driver.GetIR(), out);
+        interpreter.EnableJit(10);
+        std::string message;
+        try {
+            interpreter.Exec();
+        } catch (const std::exception& ex) {
+            message = ex.what();
+        }
+        EXPECT_EQ(interpreter.JitCompiledCount(), compiled);
+        return message;
+    };
+
+    EXPECT_EQ(run(R"(int local(int n) {
+int[4] x;
+if (n > 20) {
+x[0] = n;
+}
+return n;
+}
+void main() {
+int i;
+i = 0;
+while (i < 30) {
+local(i);
+i = i + 1;
+}
+})",
+                  0),
+              "4:6: Not array object");
+
+    EXPECT_EQ(run(R"(int[4] g;
+int get(int n) {
+if (n > 20) {
+return g[n % 4];
+}
+return n;
+}
+void main() {
+int i;
+i = 0;
+while (i < 30) {
+get(i);
+i = i + 1;
+}
+})",
+                  1),
+              "4:9: Not array object");
+}
+
+TEST(DriverFileTests, RunMappedFileOK) {
+    std::string path = ::testing::TempDir() + "driver_file_test.c";
+    {
+        std::ofstream file(path);
+        file << R"(
+int twice(int value) { return value * 2; }
+void main() {
+print("hi\t");
+print(twice(21));
+})";
+    }
+
+    Driver driver;
+    ASSERT_EQ(driver.RunFile(path), 0);
+    std::remove(path.c_str());
+
+    std::ostringstream oss;
+    Execute(Backend::TreeWalker, driver.GetIR(), oss);
+    EXPECT_EQ(oss.str(), "hi\t42");
+}
+
+TEST(DriverFileTests, RunPipeOK) {
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    std::string source = "void main() { print(7 * 6); }";
+    ASSERT_EQ(write(fds[1], source.data(), source.size()),
+              static_cast<ssize_t>(source.size()));
+    close(fds[1]);
+
+    Driver driver;
+    int result = driver.RunFile("/dev/fd/" + std::to_string(fds[0]));
+    close(fds[0]);
+    ASSERT_EQ(result, 0);
+
+    std::ostringstream oss;
+    Execute(Backend::TreeWalker, driver.GetIR(), oss);
+    EXPECT_EQ(oss.str(), "42");
+}
+
+TEST(DriverFileTests, RunMissingFileFail) {
+    Driver driver;
+    EXPECT_THROW(driver.RunFile(::testing::TempDir() + "no_such_file.c"),
+                 std::runtime_error);
+}
+
+TEST(OutputBufferTests, FormatIntsOK) {
+    std::ostringstream oss;
+    {
+        OutputBuffer out(oss);
+        out.WriteInt(0);
+        out.Write(" ");
+        out.WriteInt(-42);
+        out.Write(" ");
+        out.WriteInt(2147483647);
+        out.Write(" ");
+        out.WriteInt(-2147483647 - 1);
+        out.WriteBool(true);
+        EXPECT_EQ(oss.str(), "");
+    }
+    EXPECT_EQ(oss.str(), "0 -42 2147483647 -21474836481");
+}
+
+TEST(OutputBufferTests, ThresholdPolicyOK) {
+    std::ostringstream oss;
+    OutputBuffer out(oss, OutputBuffer::FlushPolicy::Threshold, 8);
+    out.Write("1234");
+    EXPECT_EQ(out.FlushCount(), 0u);
+    out.WriteInt(5678);
+    EXPECT_EQ(out.FlushCount(), 1u);
+    EXPECT_EQ(oss.str(), "12345678");
+    EXPECT_EQ(out.Buffered(), 0u);
+}
+
+TEST(OutputBufferTests, FramePolicyOK) {
+    std::ostringstream oss;
+    OutputBuffer out(oss, OutputBuffer::FlushPolicy::Frame);
+    out.Write("\033[2J");
+    out.Write("frame 1");
+    EXPECT_EQ(oss.str(), "");
+    out.Write("\033[2J");
+    EXPECT_EQ(oss.str(), "\033[2Jframe 1");
+    EXPECT_EQ(out.FlushCount(), 1u);
+}
+
+TEST(OutputBufferTests, LargeWriteOK) {
+    std::ostringstream oss;
+    OutputBuffer out(oss);
+    std::string large(OutputBuffer::kCapacity + 1, 'x');
+    out.Write("a");
+    out.Write(large);
+    EXPECT_EQ(out.FlushCount(), 2u);
+    EXPECT_EQ(oss.str(), "a" + large);
+}
+
+TEST(OutputBufferTests, FileDescriptorOK) {
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    {
+        OutputBuffer out(fds[1]);
+        out.Write("sum ");
+        out.WriteInt(123);
+    }
+    close(fds[1]);
+    char buf[16] = {};
+    EXPECT_EQ(read(fds[0], buf, sizeof(buf)), 7);
+    close(fds[0]);
+    EXPECT_EQ(std::string(buf), "sum 123");
+}
+
+TEST(DriverStatsTests, CountsOK) {
+    std::istringstream iss(R"(
+int twice(int value) { return value * 2; }
+void main() {
+print(twice(21));
+})");
+
+    Driver driver;
+    driver.EnableStats();
+    ASSERT_EQ(driver.Run(iss), 0);
+
+    std::ostringstream oss;
+    OutputBuffer out(oss);
+    EXPECT_EQ(driver.Execute(Backend::TreeWalker, out), 1);
+    out.Flush();
+    EXPECT_EQ(oss.str(), "42");
+
+    const auto& stats = driver.GetStats();
+    EXPECT_EQ(stats.tokens, 28u);
+    EXPECT_EQ(stats.functions, 2u);
+    // twice and main; parameters are not symbols of the IR.
+    EXPECT_EQ(stats.symbols, 2u);
+    EXPECT_GT(stats.ast_nodes, 0u);
+    EXPECT_GT(stats.scan.wall.count(), 0);
+    EXPECT_GT(stats.execute.wall.count(), 0);
+    EXPECT_GT(stats.execute.peak_rss_kb, 0);
+}
+
+TEST(DriverStatsTests, ThreadAllocationsOK) {
+    auto before = ThreadAllocations();
+    CountAllocation(24);
+    auto after = ThreadAllocations();
+    EXPECT_EQ(after.count - before.count, 1u);
+    EXPECT_EQ(after.bytes - before.bytes, 24u);
+}
+
+TEST(SamplingProfilerTests, CollapsedStacksOK) {
+    std::istringstream iss(R"(int twice(int value) {
+return value * 2;
+}
+void main() {
+print(twice(21));
+})");
+
+    Driver driver;
+    driver.SetInlineBudget(0);
+    ASSERT_EQ(driver.Run(iss), 0);
+
+    // Samples every node visit.
+    SamplingProfiler profiler(SamplingProfiler::Mode::Count, 1);
+    std::ostringstream oss;
+    OutputBuffer out(oss);
+    Interpreter interpreter(driver.GetIR(), out);
+    interpreter.SetProfiler(&profiler);
+    interpreter.Exec();
+    out.Flush();
+    EXPECT_EQ(oss.str(), "42");
+
+    std::ostringstream collapsed;
+    profiler.WriteCollapsed(collapsed);
+    EXPECT_EQ(collapsed.str(), "main:5 3\nmain:5;twice:2 3\n");
+    EXPECT_EQ(profiler.SampleCount(), 6u);
+
+    std::ostringstream report;
+    profiler.WriteReport(report);
+    EXPECT_NE(report.str().find("twice:2"), std::string::npos);
+}
+
+class IRCacheTests : public ::testing::Test {
+   protected:
+    void TearDown() override { std::remove(path_.c_str()); }
+
+    // Compiles source through the cache and returns the program output.
+    std::string Run(const std::string& source, bool* cached,
+                    Backend backend = Backend::TreeWalker) {
+        std::istringstream iss(source);
+        Driver driver;
+        driver.SetIRCache(path_);
+        if (driver.Run(iss)) throw std::runtime_error("Driver run error");
+        *cached = driver.LoadedFromCache();
+
+        std::ostringstream oss;
+        Execute(backend, driver.GetIR(), oss);
+        return oss.str();
+    }
+
+    std::string path_ = ::testing::TempDir() + "ir_cache_test.irc";
+};
+
+TEST_F(IRCacheTests, RoundTripOK) {
+    std::string source = R"(
+int table[10];
+bool flag;
+int sum(int n, bool twice) {
+    int i;
+    int total;
+    i = 0;
+    total = 0;
+    while (i < n) {
+        table[i] = i * i;
+        total = total + table[i];
+        i = i + 1;
+    }
+    if (twice) total = total * 2;
+    return total;
+}
+void main() {
+    flag = 3 > 2;
+    print("sum ");
+    print(sum(10, flag));
+    print(flag);
+})";
+
+    bool cached = true;
+    EXPECT_EQ(Run(source, &cached), "sum 5701");
+    EXPECT_FALSE(cached);
+    for (auto backend :
+         {Backend::TreeWalker, Backend::Bytecode, Backend::Jit}) {
+        EXPECT_EQ(Run(source, &cached, backend), "sum 5701");
+        EXPECT_TRUE(cached);
+    }
+}
+
+TEST_F(IRCacheTests, ChangedSourceRecompiledOK) {
+    bool cached = true;
+    EXPECT_EQ(Run("void main() { print(1); }", &cached), "1");
+    EXPECT_FALSE(cached);
+    EXPECT_EQ(Run("void main() { print(2); }", &cached), "2");
+    EXPECT_FALSE(cached);
+    EXPECT_EQ(Run("void main() { print(2); }", &cached), "2");
+    EXPECT_TRUE(cached);
+}
+
+TEST_F(IRCacheTests, TruncatedCacheIgnoredOK) {
+    bool cached = true;
+    std::string source = "void main() { print(7); }";
+    EXPECT_EQ(Run(source, &cached), "7");
+
+    std::string data;
+    {
+        std::ifstream file(path_, std::ios::binary);
+        data.assign(std::istreambuf_iterator<char>(file), {});
+    }
+    {
+        std::ofstream file(path_, std::ios::binary | std::ios::trunc);
+        file.write(data.data(), data.size() / 2);
+    }
+
+    EXPECT_EQ(Run(source, &cached), "7");
+    EXPECT_FALSE(cached);
+    EXPECT_EQ(Run(source, &cached), "7");
+    EXPECT_TRUE(cached);
+}
+
+TEST_F(IRCacheTests, CorruptedRecordIgnoredOK) {
+    bool cached = false;
+    std::string source = R"(
+int table[4];
+int twice(int n) { return n * 2; }
+void main() {
+    int i;
+    i = 0;
+    while (i < 4) {
+        table[i] = twice(i);
+        i = i + 1;
+    }
+    print(table[3]);
+}
+)";
+    EXPECT_EQ(Run(source, &cached), "6");
+
+    std::string data;
+    {
+        std::ifstream file(path_, std::ios::binary);
+        data.assign(std::istreambuf_iterator<char>(file), {});
+    }
+    // Every damaged byte, header and records alike, is detected.
+    for (size_t i = 0; i < data.size(); ++i) {
+        {
+            std::string damaged = data;
+            damaged[i] ^= 0x5a;
+            std::ofstream file(path_, std::ios::binary | std::ios::trunc);
+            file.write(damaged.data(), damaged.size());
+        }
+        EXPECT_EQ(Run(source, &cached), "6");
+        EXPECT_FALSE(cached) << "byte " << i;
+    }
+}
+
+TEST(ThreadPoolTests, RunsEveryTaskOK) {
+    std::atomic<int> sum{0};
+    {
+        ThreadPool pool(4);
+        for (int i = 1; i <= 1000; ++i) {
+            pool.Submit([&sum, i] { sum += i; });
+        }
+        pool.Wait();
+        EXPECT_EQ(sum, 500500);
+
+        pool.Submit([&sum] { sum = 0; });
+        pool.Wait();
+        EXPECT_EQ(sum, 0);
+    }
+}
+
+TEST(BatchRunnerTests, ResultsInInputOrderOK) {
+    std::vector<std::string> sources = {
+        "int fib(int n) { if (n < 2) return n;"
+        " return fib(n - 1) + fib(n - 2); }"
+        "int main() { print(fib(20)); return 0; }",
+        "int main() { print(\"two\"); return 2; }",
+        "void main() { print(x); }",
+        "int idx(int n) { return n; }"
+        "void main() { int a[2]; print(1); a[idx(5)] = 1; }",
+        "int main() { print(1); return 1; }",
+    };
+    std::vector<std::string> paths;
+    for (size_t i = 0; i < sources.size(); ++i) {
+        paths.push_back(::testing::TempDir() + "batch_" + std::to_string(i) +
+                        ".c");
+        std::ofstream(paths.back()) << sources[i];
+    }
+    paths.push_back(::testing::TempDir() + "batch_missing.c");
+
+    BatchRunner::Options options;
+    options.jobs = 3;
+    auto results = BatchRunner(options).Run(paths);
+    for (const auto& path : paths) std::remove(path.c_str());
+
+    ASSERT_EQ(results.size(), paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+        EXPECT_EQ(results[i].path, paths[i]);
+    }
+    EXPECT_EQ(results[0].output, "6765");
+    EXPECT_EQ(results[0].exit_code, 0);
+    EXPECT_FALSE(results[0].failed);
+    EXPECT_EQ(results[1].output, "two");
+    EXPECT_EQ(results[1].exit_code, 2);
+    EXPECT_FALSE(results[1].failed);
+    EXPECT_TRUE(results[2].failed);
+    EXPECT_NE(results[2].diagnostics.find("Undeclared variable x"),
+              std::string::npos);
+    EXPECT_EQ(results[3].output, "1");
+    EXPECT_TRUE(results[3].failed);
+    EXPECT_NE(results[3].diagnostics.find("out of bounds"),
+              std::string::npos);
+    EXPECT_EQ(results[4].exit_code, 1);
+    EXPECT_FALSE(results[4].failed);
+    EXPECT_TRUE(results[5].failed);
+    EXPECT_NE(results[5].diagnostics.find("Cannot open"), std::string::npos);
+}
@@ -0,0 +1,308 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "ast/arithmetic_op.h"
+#include "ast/assign.h"
+#include "ast/fun_call.h"
+#include "ast/function.h"
+#include "ast/integer.h"
+#include "ast/print.h"
+#include "ast/program.h"
+#include "ast/return.h"
+#include "ast/var.h"
+#include "bounds_check_eliminator.h"
+#include "constant_folder.h"
+#include "dead_code_eliminator.h"
+#include "inliner.h"
+#include "parser_driver.h"
+#include "semantic_visitor.h"
+
+class OptimizerTests : public ::testing::Test {
+   protected:
+    // Parses, checks and optimizes the program; returns its last function.
+    AST::Function* Optimize(std::istringstream& iss) {
+        EzAquarii::ParserDriver parser_driver;
+        parser_driver.switchInputStream(&iss);
+        if (parser_driver.parse()) throw std::runtime_error("Parser error");
+
+        ir_.SetAST(parser_driver.GetAST());
+        SemanticVisitor semantic_visitor(&ir_);
+        ir_.GetAST()->accept(&semantic_visitor);
+
+        Inliner inliner(&ir_, budget_);
+        inliner.Run();
+        inlined_ = inliner.InlinedCount();
+
+        ConstantFolder constant_folder(&ir_);
+        constant_folder.Run();
+
+        DeadCodeEliminator dead_code_eliminator(&ir_);
+        dead_code_eliminator.Run();
+        for (const auto& dead : dead_code_eliminator.Removed()) {
+            std::ostringstream line;
+            line << dead;
+            removed_.push_back(line.str());
+        }
+
+        BoundsCheckEliminator bounds_check_eliminator(&ir_);
+        bounds_check_eliminator.Run();
+        unchecked_ = bounds_check_eliminator.EliminatedCount();
+
+        auto* program = static_cast<AST::Program*>(ir_.GetAST().get());
+        return static_cast<AST::Function*>(program->globals.back().get());
+    }
+
+    static AST::ASTNode* ReturnExpr(AST::Function* function) {
+        auto* ret = static_cast<AST::Return*>(function->body.back().get());
+        return ret->expr.get();
+    }
+
+    static int IntegerValue(AST::ASTNode* node) {
+        EXPECT_EQ(node->node_type, AST::NodeType::Integer);
+        return static_cast<AST::Integer*>(node)->value;
+    }
+
+    IR ir_;
+    int budget_ = Inliner::kDefaultBudget;
+    int inlined_ = 0;
+    int unchecked_ = 0;
+    std::vector<std::string> removed_;
+};
+
+TEST_F(OptimizerTests, FoldArithmeticOK) {
+    std::istringstream iss(R"(int main() {
+return 2 * 3 + 10 / 4 - 7 % 4;
+})");
+
+    auto* main = Optimize(iss);
+    EXPECT_EQ(IntegerValue(ReturnExpr(main)), 5);
+}
+
+TEST_F(OptimizerTests, FoldDivisionByZeroSkipped) {
+    std::istringstream iss(R"(int main() {
+return 1 / 0;
+})");
+
+    auto* main = Optimize(iss);
+    EXPECT_EQ(ReturnExpr(main)->node_type, AST::NodeType::ArithOp);
+}
+
+TEST_F(OptimizerTests, SimplifyIdentitiesOK) {
+    std::istringstream iss(R"(void main() {
+}
+
+int f(int a) {
+return 0 + a * 1 - 0;
+})");
+
+    auto* f = Optimize(iss);
+    EXPECT_EQ(ReturnExpr(f)->node_type, AST::NodeType::Var);
+}
+
+TEST_F(OptimizerTests, PropagateSingleAssignmentOK) {
+    std::istringstream iss(R"(int main() {
+int height;
+height = 10;
+int last;
+last = height - 1;
+return last * 2;
+})");
+
+    auto* main = Optimize(iss);
+    EXPECT_EQ(IntegerValue(ReturnExpr(main)), 18);
+}
+
+TEST_F(OptimizerTests, PropagateReassignedVariableSkipped) {
+    std::istringstream iss(R"(int main() {
+int i;
+i = 0;
+while (i < 3) {
+i = i + 1;
+}
+return i;
+})");
+
+    auto* main = Optimize(iss);
+    EXPECT_EQ(ReturnExpr(main)->node_type, AST::NodeType::Var);
+}
+
+TEST_F(OptimizerTests, PruneConstantIfOK) {
+    std::istringstream iss(R"(void main() {
+if (1 < 2) {
+print (1);
+} else {
+print (2);
+}
+while (2 < 1) {
+print (3);
+}
+})");
+
+    auto* main = Optimize(iss);
+    ASSERT_EQ(main->body.size(), 1);
+    auto* print = static_cast<AST::Print*>(main->body[0].get());
+    EXPECT_EQ(IntegerValue(print->expr.get()), 1);
+}
+
+TEST_F(OptimizerTests, RemoveUnreachableOK) {
+    std::istringstream iss(R"(int main() {
+int i;
+i = rand();
+if (i < 0) {
+return 1;
+print (i);
+} else {
+return 2;
+}
+print (3);
+return 0;
+})");
+
+    auto* main = Optimize(iss);
+    ASSERT_EQ(main->body.size(), 3);
+    EXPECT_EQ(removed_, (std::vector<std::string>{
+                            "6:1: removed unreachable statement",
+                            "10:1: removed unreachable statement",
+                            "11:1: removed unreachable statement",
+                        }));
+}
+
+TEST_F(OptimizerTests, RemoveDeadStoresAndUnusedVariablesOK) {
+    std::istringstream iss(R"(void main() {
+int unused;
+int x;
+x = 1;
+x = rand();
+print (x);
+int y;
+y = 2;
+int i;
+i = rand();
+while (i < 10) {
+i = i + 1;
+}
+})");
+
+    auto* main = Optimize(iss);
+    EXPECT_EQ(main->body.size(), 6);
+    EXPECT_EQ(removed_, (std::vector<std::string>{
+                            "8:3: removed dead store to 'y'",
+                            "4:3: removed dead store to 'x'",
+                            "2:1: removed unused variable 'unused'",
+                            "7:1: removed unused variable 'y'",
+                        }));
+}
+
+TEST_F(OptimizerTests, InlineLeafFunctionOK) {
+    std::istringstream iss(R"(int abs(int x) {
+if (x < 0) return (0) - (x);
+return x;
+}
+
+int main() {
+int x;
+x = rand();
+print(abs(x));
+return abs(0 - 10) + abs(3);
+})");
+
+    auto* main = Optimize(iss);
+    EXPECT_EQ(inlined_, 3);
+    for (auto stmt : main->body) {
+        EXPECT_NE(stmt->node_type, AST::NodeType::FunCall);
+    }
+    EXPECT_EQ(IntegerValue(ReturnExpr(main)), 13);
+}
+
+TEST_F(OptimizerTests, InlineOverBudgetSkipped) {
+    budget_ = 4;
+    std::istringstream iss(R"(int abs(int x) {
+if (x < 0) return (0) - (x);
+return x;
+}
+
+int main() {
+return abs(rand());
+})");
+
+    auto* main = Optimize(iss);
+    EXPECT_EQ(inlined_, 0);
+    EXPECT_EQ(ReturnExpr(main)->node_type, AST::NodeType::FunCall);
+}
+
+TEST_F(OptimizerTests, InlineNonLeafFunctionSkipped) {
+    std::istringstream iss(R"(int fib(int n) {
+if (n < 2) return n;
+return fib(n - 1) + fib(n - 2);
+}
+
+int main() {
+return fib(10);
+})");
+
+    Optimize(iss);
+    EXPECT_EQ(inlined_, 0);
+}
+
+TEST_F(OptimizerTests, EliminateBoundsChecksInCountedLoopsOK) {
+    std::istringstream iss(R"(
+int fire[2000];
+void main() {
+int HEIGHT;
+HEIGHT = 25;
+int WIDTH;
+WIDTH = 80;
+int i;
+int j;
+j = 1;
+while (j < HEIGHT) {
+i = 0;
+while (i < WIDTH) {
+fire[i + (j - 1) * WIDTH] = fire[i + j * WIDTH];
+i = i + 1;
+}
+j = j + 1;
+}
+i = 0;
+while (i < WIDTH) {
+int idx;
+idx = i + (HEIGHT - 1) * WIDTH;
+if (fire[idx] < 16) fire[idx] = 16;
+i = i + 1;
+}
+})");
+
+    Optimize(iss);
+    EXPECT_EQ(unchecked_, 4);
+}
+
+TEST_F(OptimizerTests, EliminateBoundsChecksUnprovenSkipped) {
+    std::istringstream iss(R"(
+int a[10];
+void main() {
+int i;
+i = 0;
+while (i < 11) {
+a[i] = 1;
+i = i + 1;
+}
+i = 0;
+while (i < 10) {
+i = i + 1;
+a[i] = 2;
+}
+int k;
+k = 0;
+while (true) {
+a[k % 10] = a[(k + 1) % 10];
+k = k + 1;
+}
+})");
+
+    Optimize(iss);
+    EXPECT_EQ(unchecked_, 0);
+}
@@ -3,11 +3,14 @@
 #include <memory>
 #include <sstream>
 
+#include "ast/arithmetic_op.h"
 #include "ast/function.h"
+#include "ast/logic_op.h"
 #include "ast/print.h"
 #include "ast/program.h"
 #include "ast/string_literal.h"
 #include "ast/type.h"
+#include "ast/var.h"
 #include "parser_driver.h"
 
 class ParserTests : public ::testing::Test {
@@ -163,3 +166,99 @@ print ("\n\033\n\t\034\n\x13\7");
 
     EXPECT_EQ(str_lit->value, "\n\033\n\t\034\n\x13\7");
 }
+
+TEST_F(ParserTests, OperatorsOK) {
+    std::istringstream iss(R"(int main() {
+print(1 + 2);
+print(1 - 2);
+print(1 * 2);
+print(1 / 2);
+print(1 % 2);
+print(1 < 2);
+print(1 > 2);
+print(1 == 2);
+})");
+
+    auto ast = Init(iss);
+    ASSERT_TRUE(ast);
+
+    auto prog = std::dynamic_pointer_cast<AST::Program>(ast);
+    auto main_func = std::dynamic_pointer_cast<AST::Function>(prog->globals[0]);
+    ASSERT_EQ(main_func->body.size(), 8);
+
+    auto expr = [&](int i) {
+        return std::dynamic_pointer_cast<AST::Print>(main_func->body[i])->expr;
+    };
+    AST::Operator arith[] = {AST::Operator::Add, AST::Operator::Sub,
+                             AST::Operator::Mul, AST::Operator::Div,
+                             AST::Operator::Mod};
+    for (int i = 0; i < 5; ++i) {
+        auto op = std::dynamic_pointer_cast<AST::ArithOp>(expr(i));
+        ASSERT_TRUE(op);
+        EXPECT_EQ(op->op, arith[i]);
+    }
+    AST::Operator logic[] = {AST::Operator::Less, AST::Operator::Greater,
+                             AST::Operator::Equal};
+    for (int i = 0; i < 3; ++i) {
+        auto op = std::dynamic_pointer_cast<AST::LogicOp>(expr(5 + i));
+        ASSERT_TRUE(op);
+        EXPECT_EQ(op->op, logic[i]);
+    }
+}
+
+TEST_F(ParserTests, TreeOutlivesParserOK) {
+    std::istringstream iss(R"(int main() { print(1 + 2); })");
+
+    std::shared_ptr<AST::ASTNode> ast;
+    {
+        EzAquarii::ParserDriver parser_driver;
+        parser_driver.switchInputStream(&iss);
+        ASSERT_EQ(parser_driver.parse(), 0);
+        ast = parser_driver.GetAST();
+    }
+
+    auto prog = std::dynamic_pointer_cast<AST::Program>(ast);
+    ASSERT_TRUE(prog);
+    auto main_func = std::dynamic_pointer_cast<AST::Function>(prog->globals[0]);
+    EXPECT_EQ(main_func->name, "main");
+    EXPECT_EQ(main_func->body.size(), 1);
+}
+
+TEST_F(ParserTests, ReparseOK) {
+    std::string source = "int main() { print(1 + 2); }";
+    EzAquarii::ParserDriver parser_driver;
+    parser_driver.switchInputBuffer(source);
+    ASSERT_EQ(parser_driver.parse(), 0);
+    auto first = parser_driver.GetAST();
+    size_t nodes = parser_driver.NodeCount();
+
+    parser_driver.switchInputBuffer(source);
+    ASSERT_EQ(parser_driver.parse(), 0);
+    EXPECT_NE(parser_driver.GetAST(), first);
+    EXPECT_EQ(parser_driver.NodeCount(), nodes);
+}
+
+TEST_F(ParserTests, IdentifiersInternedOK) {
+    std::istringstream iss(R"(int main() {
+print(value);
+print(value);
+print(other);
+})");
+
+    auto ast = Init(iss);
+    ASSERT_TRUE(ast);
+
+    auto prog = std::dynamic_pointer_cast<AST::Program>(ast);
+    auto main_func = std::dynamic_pointer_cast<AST::Function>(prog->globals[0]);
+    ASSERT_EQ(main_func->body.size(), 3);
+
+    auto name = [&](int i) {
+        auto print = std::dynamic_pointer_cast<AST::Print>(main_func->body[i]);
+        return std::dynamic_pointer_cast<AST::Var>(print->expr)->name;
+    };
+    EXPECT_EQ(name(0), name(1));
+    EXPECT_NE(name(0), name(2));
+    EXPECT_EQ(name(0), AST::Symbol("value"));
+    EXPECT_EQ(name(2).Str(), "other");
+    EXPECT_EQ(main_func->name, AST::Symbol("main"));
+}
@@ -1,18 +1,26 @@
 #include <gtest/gtest.h>
 
+#include <map>
 #include <memory>
 #include <sstream>
+#include <string>
 
+#include "ast/arithmetic_op.h"
+#include "ast/assign.h"
+#include "ast/fun_call.h"
 #include "ast/function.h"
 #include "ast/program.h"
+#include "ast/return.h"
 #include "ast/type.h"
+#include "ast/var.h"
+#include "ast/while.h"
 #include "parser_driver.h"
 #include "semantic_visitor.h"
 #include "utils.h"
 
 class SemanticAnalysisTests : public ::testing::Test {
    protected:
-    void Exec(std::istringstream& iss) {
+    void Exec(std::istringstream& iss, size_t jobs = 1) {
         EzAquarii::ParserDriver parser_driver;
 
         parser_driver.switchInputStream(&iss);
@@ -23,12 +31,13 @@ class SemanticAnalysisTests : public ::testing::Test {
         auto ast = parser_driver.GetAST();
         ASSERT_TRUE(ast);
 
-        IR ir;
-        ir.SetAST(ast);
+        ir_.SetAST(ast);
 
-        SemanticVisitor semantic_visitor(&ir);
+        SemanticVisitor semantic_visitor(&ir_, jobs);
         ast->accept(&semantic_visitor);
     }
+
+    IR ir_;
 };
 
 TEST_F(SemanticAnalysisTests, ProgramMainFunctionOK) {
@@ -782,3 +791,137 @@ j = i[3];
 
     ExpectThrow(Exec(iss), "5:6: Array assign out of bounds");
 }
+
+TEST_F(SemanticAnalysisTests, VarSlotResolutionOK) {
+    std::istringstream iss(R"(
+int g;
+void main() {
+int i;
+while (true) {
+int j;
+j = i;
+}
+int k;
+k = g;
+}
+)");
+
+    ASSERT_NO_THROW(Exec(iss));
+    EXPECT_EQ(ir_.GetGlobalCount(), 1);
+
+    auto prog = std::dynamic_pointer_cast<AST::Program>(ir_.GetAST());
+    auto main_func = std::dynamic_pointer_cast<AST::Function>(prog->globals[1]);
+    ASSERT_TRUE(main_func);
+    EXPECT_EQ(main_func->frame_size, 2);
+
+    auto loop = std::dynamic_pointer_cast<AST::While>(main_func->body[1]);
+    ASSERT_TRUE(loop);
+    auto inner = std::dynamic_pointer_cast<AST::Assign>(loop->body[1]);
+    ASSERT_TRUE(inner);
+    EXPECT_EQ(inner->ref.scope, AST::VarRef::Scope::Local);
+    EXPECT_EQ(inner->ref.index, 1);
+    auto i_var = std::dynamic_pointer_cast<AST::Var>(inner->expr);
+    ASSERT_TRUE(i_var);
+    EXPECT_EQ(i_var->ref.index, 0);
+
+    // k reuses the slot released by the loop body.
+    auto outer = std::dynamic_pointer_cast<AST::Assign>(main_func->body[3]);
+    ASSERT_TRUE(outer);
+    EXPECT_EQ(outer->ref.index, 1);
+    auto g_var = std::dynamic_pointer_cast<AST::Var>(outer->expr);
+    ASSERT_TRUE(g_var);
+    EXPECT_EQ(g_var->ref.scope, AST::VarRef::Scope::Global);
+    EXPECT_EQ(g_var->ref.index, 0);
+}
+
+TEST_F(SemanticAnalysisTests, FunCallTargetResolutionOK) {
+    std::istringstream iss(R"(
+int square(int x) { return x * x; }
+void main() {
+int y;
+y = square(3);
+}
+)");
+
+    ASSERT_NO_THROW(Exec(iss));
+
+    auto prog = std::dynamic_pointer_cast<AST::Program>(ir_.GetAST());
+    auto square = std::dynamic_pointer_cast<AST::Function>(prog->globals[0]);
+    auto main_func = std::dynamic_pointer_cast<AST::Function>(prog->globals[1]);
+    ASSERT_TRUE(square);
+    ASSERT_TRUE(main_func);
+
+    auto assign = std::dynamic_pointer_cast<AST::Assign>(main_func->body[1]);
+    ASSERT_TRUE(assign);
+    auto call = std::dynamic_pointer_cast<AST::FunCall>(assign->expr);
+    ASSERT_TRUE(call);
+    EXPECT_EQ(call->target, square.get());
+}
+
+// Program of count functions, one per line, each calling the previous one,
+// followed by main. Function i has the body bodies[i] when given.
+static std::string ManyFunctions(size_t count,
+                                 const std::map<size_t, std::string>& bodies) {
+    std::string source;
+    for (size_t i = 0; i < count; ++i) {
+        auto name = "f" + std::to_string(i);
+        auto body = i ? "return f" + std::to_string(i - 1) + "(n) + 1;"
+                      : std::string("return n;");
+        if (auto iter = bodies.find(i); iter != bodies.end()) {
+            body = iter->second;
+        }
+        source += "int " + name + "(int n) { " + body + " }\n";
+    }
+    source += "void main() { print(f" + std::to_string(count - 1) +
+              "(0)); }\n";
+    return source;
+}
+
+TEST_F(SemanticAnalysisTests, ParallelBodiesOK) {
+    std::istringstream iss(ManyFunctions(200, {}));
+
+    ASSERT_NO_THROW(Exec(iss, 4));
+
+    auto prog = std::dynamic_pointer_cast<AST::Program>(ir_.GetAST());
+    for (size_t i = 1; i < 200; ++i) {
+        auto function =
+            std::dynamic_pointer_cast<AST::Function>(prog->globals[i]);
+        ASSERT_TRUE(function);
+        auto ret = std::dynamic_pointer_cast<AST::Return>(function->body[0]);
+        ASSERT_TRUE(ret);
+        auto sum = std::dynamic_pointer_cast<AST::ArithOp>(ret->expr);
+        ASSERT_TRUE(sum);
+        auto call = std::dynamic_pointer_cast<AST::FunCall>(sum->lhs);
+        ASSERT_TRUE(call);
+        EXPECT_EQ(call->target, prog->globals[i - 1].get());
+        EXPECT_EQ(function->frame_size, 1);
+    }
+    EXPECT_EQ(ir_.FunctionCount(), 201);
+}
+
+TEST_F(SemanticAnalysisTests, ParallelEarliestErrorOK) {
+    // Body errors in f37 and f150 and a redefinition at f180: the error
+    // reported is the first in source order, whatever thread finds it.
+    auto source = ManyFunctions(200, {{37, "return m;"},
+                                      {150, "return true;"},
+                                      {180, "return n; } int f3(int n) {"
+                                            " return n;"}});
+    for (size_t jobs : {1, 4}) {
+        std::istringstream iss(source);
+        ExpectThrow(Exec(iss, jobs), "38:25: Undeclared variable m");
+    }
+}
+
+TEST_F(SemanticAnalysisTests, ParallelDeclarationOrderFail) {
+    // A body sees neither the globals nor the functions declared after
+    // it, as in a single pass.
+    auto global = ManyFunctions(100, {{20, "return g;"}});
+    global.insert(global.find("int f60"), "int g;\n");
+    std::istringstream global_iss(global);
+    ExpectThrow(Exec(global_iss, 4), "21:25: Undeclared variable g");
+
+    std::istringstream call_iss(
+        ManyFunctions(100, {{20, "return f90(n);"}}));
+    ExpectThrow(Exec(call_iss, 4),
+                "21:25: 'f90' was not declared in this scope");
+}